@@ -0,0 +1,48 @@
+#include <catch2/catch.hpp>
+
+#include <bit>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "ara/core/byte_operations.h"
+#include "byte_helpers.h"
+
+namespace core = ara::core;
+using tests::PatternBytes;
+
+TEST_CASE("Bulk bitwise operations against the per-ByteImpl loop",
+          "[benchmark][byte_operations]")
+{
+    for (std::size_t n : {64u, 4096u, 65536u})
+    {
+        auto       dst  = PatternBytes(n, 1);
+        auto const src  = PatternBytes(n, 200);
+        auto const size = " " + std::to_string(n) + " B";
+
+        BENCHMARK("XorBytes" + size)
+        {
+            core::XorBytes(dst, src);
+            Catch::Benchmark::keep_memory(dst.data());
+        };
+        BENCHMARK("ByteImpl ^= loop" + size)
+        {
+            for (std::size_t i = 0; i < n; ++i) { dst[i] ^= src[i]; }
+            Catch::Benchmark::keep_memory(dst.data());
+        };
+        BENCHMARK("PopCount" + size)
+        {
+            return core::PopCount(src);
+        };
+        BENCHMARK("std::popcount loop" + size)
+        {
+            std::size_t count = 0;
+            for (auto b : src)
+            {
+                count += static_cast<std::size_t>(
+                  std::popcount(core::to_integer<unsigned char>(b)));
+            }
+            return count;
+        };
+    }
+}
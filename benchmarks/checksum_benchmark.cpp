@@ -0,0 +1,46 @@
+#include <catch2/catch.hpp>
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "ara/core/checksum.h"
+#include "byte_helpers.h"
+
+namespace core = ara::core;
+using tests::PatternBytes;
+
+// throughput in GB/s is the buffer size over the mean, 1 MiB in 100 us is 10.5
+TEST_CASE("CRC throughput per variant and kernel", "[benchmark][checksum]")
+{
+    for (std::size_t n : {64u, 4096u, 1048576u})
+    {
+        auto const data = PatternBytes(n, 11);
+        auto const size = " " + std::to_string(n) + " B";
+
+        BENCHMARK("CRC-8/SAE-J1850 sliced" + size)
+        {
+            return core::Crc8SaeJ1850::Compute(data);
+        };
+        BENCHMARK("CRC-16/CCITT-FALSE sliced" + size)
+        {
+            return core::Crc16CcittFalse::Compute(data);
+        };
+        BENCHMARK("CRC-32 sliced" + size)
+        {
+            return core::Crc32::Compute(data);
+        };
+        BENCHMARK("CRC-32C sliced" + size)
+        {
+            return core::internal::Crc32CUpdateSliced(0xFFFFFFFF, data);
+        };
+        BENCHMARK("CRC-32C runtime selected" + size)
+        {
+            return core::Crc32C::Compute(data);
+        };
+        BENCHMARK("CRC-64/XZ sliced" + size)
+        {
+            return core::Crc64Xz::Compute(data);
+        };
+    }
+}
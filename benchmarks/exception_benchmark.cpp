@@ -0,0 +1,66 @@
+#include <catch2/catch.hpp>
+
+#include <exception>
+#include <string>
+
+#include "ara/core/core_error_domain.h"
+
+namespace core = ara::core;
+
+namespace {
+/**
+ * Exception holding an ErrorCode like ara::core::Exception, but never
+ * capturing the stack, as the baseline of a throw.
+ */
+class PlainException : public std::exception
+{
+ public:
+    explicit PlainException(core::ErrorCode const& err) noexcept : error{err} {}
+
+    const char* what() const noexcept override
+    {
+        return error.Message().data();
+    }
+
+ private:
+    core::ErrorCode error;
+};
+
+template<typename E> [[gnu::noinline]] void ThrowAtDepth(int depth)
+{
+    if (depth == 0)
+    {
+        throw E{core::MakeErrorCode(core::CoreErrc::kInvalidArgument, 0)};
+    }
+    ThrowAtDepth<E>(depth - 1);
+}
+
+template<typename E> int ThrowAndCatch()
+{
+    try
+    {
+        ThrowAtDepth<E>(16);
+    }
+    catch (E const&)
+    {
+        return 1;
+    }
+    return 0;
+}
+}  // namespace
+
+TEST_CASE("Exception per-throw cost with and without stack capture",
+          "[benchmark][exception]")
+{
+    std::string const capture =
+      core::kExceptionBacktraceEnabled ? "capture" : "no capture";
+
+    BENCHMARK("throw PlainException, no capture")
+    {
+        return ThrowAndCatch<PlainException>();
+    };
+    BENCHMARK("throw ara::core::Exception, " + capture)
+    {
+        return ThrowAndCatch<core::Exception>();
+    };
+}
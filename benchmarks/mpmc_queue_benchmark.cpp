@@ -0,0 +1,65 @@
+#include <catch2/catch.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "ara/core/mpmc_queue.h"
+#include "thread_affinity.h"
+
+namespace core = ara::core;
+
+namespace {
+
+constexpr std::size_t kMessages = 1'000'000;
+
+/**
+ * Moves kMessages through a queue with pairs producers and pairs consumers,
+ * producer i pinned to CPU 2i and consumer i to CPU 2i + 1.
+ */
+std::uint64_t Transfer(core::MpmcQueue<std::uint64_t>& queue, unsigned pairs)
+{
+    std::atomic<std::uint64_t> sum{0};
+    std::vector<std::thread>   threads;
+    for (unsigned pair = 0; pair < pairs; ++pair)
+    {
+        // the first pairs take one message more if they do not divide evenly
+        std::size_t const count =
+          kMessages / pairs + (pair < kMessages % pairs ? 1 : 0);
+        threads.emplace_back([&queue, count, pair] {
+            benchmarks::ScopedAffinity const affinity{2 * pair};
+            for (std::uint64_t i = 0; i < count; ++i) { queue.Push(i); }
+        });
+        threads.emplace_back([&queue, &sum, count, pair] {
+            benchmarks::ScopedAffinity const affinity{2 * pair + 1};
+            std::uint64_t                    local = 0;
+            for (std::size_t i = 0; i < count; ++i) { local += queue.Pop(); }
+            sum += local;
+        });
+    }
+    for (auto& thread : threads) { thread.join(); }
+    return sum;
+}
+
+}  // namespace
+
+// total throughput is kMessages over the mean, 10 ms is 100M/s
+TEST_CASE("MpmcQueue scalability with 1 to N producer/consumer pairs",
+          "[benchmark][mpmc_queue]")
+{
+    core::MpmcQueue<std::uint64_t> queue{1024};
+    // one CPU per thread, so that no two pinned threads share a CPU
+    unsigned const maxPairs =
+      std::max(std::thread::hardware_concurrency() / 2, 1u);
+
+    for (unsigned pairs = 1; pairs <= maxPairs; ++pairs)
+    {
+        BENCHMARK(std::to_string(pairs) + " pairs, Push/Pop 1M uint64_t")
+        {
+            return Transfer(queue, pairs);
+        };
+    }
+}
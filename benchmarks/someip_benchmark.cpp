@@ -0,0 +1,64 @@
+#include <catch2/catch.hpp>
+
+#include <cstdint>
+#include <string>
+#include <tuple>
+
+#include "ara/core/map.h"
+#include "ara/core/someip.h"
+#include "ara/core/vector.h"
+
+namespace core = ara::core;
+
+namespace {
+
+struct Message
+{
+    std::uint32_t                           id = 0;
+    core::Vector<std::uint16_t>             samples;
+    core::Map<std::uint16_t, std::uint32_t> counters;
+};
+
+}  // namespace
+
+template<> struct ara::core::SerializationMembers<Message>
+{
+    static constexpr std::tuple members{
+      &Message::id, &Message::samples, &Message::counters};
+};
+
+// messages per second are the reciprocal of the mean, 100 ns is 10M msg/s
+TEST_CASE("SOME/IP messages per second", "[benchmark][someip]")
+{
+    Message message;
+    message.id = 0x01020304;
+    for (std::uint16_t i = 0; i < 64; ++i)
+    {
+        message.samples.push_back(static_cast<std::uint16_t>(i * 3));
+    }
+    for (std::uint16_t i = 0; i < 8; ++i)
+    {
+        message.counters.emplace(i, i * 1000u);
+    }
+
+    core::Byte            buffer[256];
+    core::SomeIpEncoder<> encoder{buffer};
+    REQUIRE_FALSE(encoder.Encode(message));
+    auto const payload = encoder.Written();
+
+    BENCHMARK("encode " + std::to_string(payload.size()) + " B message")
+    {
+        core::SomeIpEncoder<> e{buffer};
+        return e.Encode(message).has_value();
+    };
+    BENCHMARK("decode " + std::to_string(payload.size()) + " B message")
+    {
+        Message decoded;
+        return core::SomeIpDecoder<>{payload}.Decode(decoded).has_value();
+    };
+    BENCHMARK("decode " + std::to_string(payload.size())
+              + " B message in place")
+    {
+        return core::SomeIpDecoder<>{payload}.Decode(message).has_value();
+    };
+}
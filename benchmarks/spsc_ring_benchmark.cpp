@@ -0,0 +1,192 @@
+#include <catch2/catch.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <thread>
+#include <vector>
+
+#include "ara/core/spsc_ring.h"
+#include "thread_affinity.h"
+
+namespace core = ara::core;
+
+namespace {
+
+constexpr std::size_t kMessages = 1'000'000;
+
+using Ring = core::SpscRing<std::uint64_t, 1024>;
+
+/**
+ * Counts done elements, or yields after a failed attempt, so that the
+ * benchmarks also complete when both threads share a CPU.
+ */
+template<typename Count>
+void Retry(bool done, Count& counter, std::size_t count = 1)
+{
+    if (done)
+    {
+        counter += count;
+    }
+    else
+    {
+        std::this_thread::yield();
+    }
+}
+
+/**
+ * Runs produce on a thread pinned to CPU 0 and consume on a thread pinned to
+ * CPU 1, and waits for both.
+ */
+template<typename Producer, typename Consumer>
+void RunPinned(Producer produce, Consumer consume)
+{
+    std::thread producer{[&produce] {
+        benchmarks::ScopedAffinity const affinity{0};
+        produce();
+    }};
+    std::thread consumer{[&consume] {
+        benchmarks::ScopedAffinity const affinity{1};
+        consume();
+    }};
+    producer.join();
+    consumer.join();
+}
+
+}  // namespace
+
+// elements per second are kMessages over the mean, 10 ms is 100M/s
+TEST_CASE("SpscRing throughput between two pinned threads",
+          "[benchmark][spsc_ring]")
+{
+    auto ring = std::make_unique<Ring>();
+
+    BENCHMARK("TryPush/TryPop 1M uint64_t")
+    {
+        std::uint64_t sum = 0;
+        RunPinned(
+          [&ring] {
+              for (std::uint64_t i = 0; i < kMessages;)
+              {
+                  Retry(ring->TryPush(i), i);
+              }
+          },
+          [&ring, &sum] {
+              for (std::size_t i = 0; i < kMessages;)
+              {
+                  auto const value = ring->TryPop();
+                  sum += value.value_or(0);
+                  Retry(value.has_value(), i);
+              }
+          });
+        return sum;
+    };
+
+    BENCHMARK("PushBatch/PopBatch of 64, 1M uint64_t")
+    {
+        std::uint64_t sum = 0;
+        RunPinned(
+          [&ring] {
+              std::vector<std::uint64_t> batch(64);
+              for (std::uint64_t i = 0; i < kMessages;)
+              {
+                  for (std::uint64_t j = 0; j < batch.size(); ++j)
+                  {
+                      batch[j] = i + j;
+                  }
+                  core::Span<std::uint64_t const> const values{
+                    batch.data(), std::min<std::size_t>(64, kMessages - i)};
+                  auto const count = ring->PushBatch(values);
+                  Retry(count != 0, i, count);
+              }
+          },
+          [&ring, &sum] {
+              std::vector<std::uint64_t> batch(64);
+              for (std::size_t i = 0; i < kMessages;)
+              {
+                  auto const count = ring->PopBatch(batch);
+                  for (std::size_t j = 0; j < count; ++j) { sum += batch[j]; }
+                  Retry(count != 0, i, count);
+              }
+          });
+        return sum;
+    };
+}
+
+TEST_CASE("SpscFrameRing throughput between two pinned threads",
+          "[benchmark][spsc_ring]")
+{
+    auto ring = std::make_unique<core::SpscFrameRing<65536>>();
+
+    BENCHMARK("TryPushFrame/PopFrame 1M frames of 64 B")
+    {
+        std::size_t bytes = 0;
+        RunPinned(
+          [&ring] {
+              std::vector<core::Byte> const frame(64, core::Byte{1});
+              for (std::size_t i = 0; i < kMessages;)
+              {
+                  Retry(ring->TryPushFrame(frame), i);
+              }
+          },
+          [&ring, &bytes] {
+              for (std::size_t i = 0; i < kMessages;)
+              {
+                  auto const frame = ring->TryFrontFrame();
+                  if (frame)
+                  {
+                      bytes += frame->size();
+                      ring->PopFrame();
+                  }
+                  Retry(frame.has_value(), i);
+              }
+          });
+        return bytes;
+    };
+}
+
+// one iteration is a round trip: the mean is twice the one-way latency
+TEST_CASE("SpscRing round trip latency between two pinned threads",
+          "[benchmark][spsc_ring]")
+{
+    auto ping = std::make_unique<Ring>();
+    auto pong = std::make_unique<Ring>();
+
+    BENCHMARK_ADVANCED("round trip of one uint64_t")
+    (Catch::Benchmark::Chronometer meter)
+    {
+        // echoes every value until it receives 0
+        std::thread echo{[&ping, &pong] {
+            benchmarks::ScopedAffinity const affinity{1};
+            for (;;)
+            {
+                auto const value = ping->TryPop();
+                if (! value)
+                {
+                    std::this_thread::yield();
+                    continue;
+                }
+                while (! pong->TryPush(*value)) { std::this_thread::yield(); }
+                if (*value == 0)
+                {
+                    return;
+                }
+            }
+        }};
+
+        benchmarks::ScopedAffinity const affinity{0};
+        std::uint64_t                    next = 1;
+        meter.measure([&ping, &pong, &next] {
+            while (! ping->TryPush(next)) { std::this_thread::yield(); }
+            std::optional<std::uint64_t> value;
+            while (! (value = pong->TryPop())) { std::this_thread::yield(); }
+            ++next;
+            return *value;
+        });
+
+        while (! ping->TryPush(0)) { std::this_thread::yield(); }
+        while (! pong->TryPop()) { std::this_thread::yield(); }
+        echo.join();
+    };
+}
@@ -0,0 +1,60 @@
+/**
+ * Copyright (c) 2020
+ * umlaut Software Development and contributors
+ *
+ * SPDX-License-Identifier: MIT
+ */
+#ifndef ARA_CORE_BENCHMARKS_THREAD_AFFINITY_H_
+#define ARA_CORE_BENCHMARKS_THREAD_AFFINITY_H_
+
+#include <pthread.h>
+#include <sched.h>
+
+#include <thread>
+
+namespace benchmarks {
+
+/**
+ * Pins the calling thread to one CPU until the end of the scope, then
+ * restores its previous affinity.
+ *
+ * CPU numbers wrap around at std::thread::hardware_concurrency(), so the
+ * benchmarks also run on machines with fewer CPUs, though not in parallel.
+ */
+class ScopedAffinity final
+{
+ public:
+    explicit ScopedAffinity(unsigned cpu) noexcept
+    {
+        pinned = ::pthread_getaffinity_np(
+                   ::pthread_self(), sizeof(previous), &previous)
+                 == 0;
+        unsigned const cpus = std::thread::hardware_concurrency();
+        cpu_set_t      set;
+        CPU_ZERO(&set);
+        CPU_SET(cpus == 0 ? 0 : cpu % cpus, &set);
+        pinned =
+          pinned
+          && ::pthread_setaffinity_np(::pthread_self(), sizeof(set), &set) == 0;
+    }
+
+    ScopedAffinity(ScopedAffinity const&) = delete;
+    ScopedAffinity& operator=(ScopedAffinity const&) = delete;
+
+    ~ScopedAffinity()
+    {
+        if (pinned)
+        {
+            ::pthread_setaffinity_np(
+              ::pthread_self(), sizeof(previous), &previous);
+        }
+    }
+
+ private:
+    cpu_set_t previous;
+    bool      pinned;
+};
+
+}  // namespace benchmarks
+
+#endif  // ARA_CORE_BENCHMARKS_THREAD_AFFINITY_H_
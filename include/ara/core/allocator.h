@@ -23,6 +23,9 @@ template<class T> using Allocator = std::allocator<T>;
 /**
  * @brief AllocatorTraits
  *
+ * Supports allocators whose pointer type is a class such as OffsetPtr, see
+ * SharedMemoryAllocator.
+ *
  * @todo Define custom AllocatorTraits
  */
 template<class Alloc> using AllocatorTraits = std::allocator_traits<Alloc>;
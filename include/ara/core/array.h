@@ -8,7 +8,11 @@
 #ifndef ARA_CORE_ARRAY_H_
 #define ARA_CORE_ARRAY_H_
 
-#include <array>  // std::array
+#include <array>    // std::array
+#include <cstddef>  // std::size_t
+#include <memory>   // std::assume_aligned
+#include <type_traits>
+#include <utility>  // std::move, std::tuple_size, std::tuple_element
 
 namespace ara::core {
 /**
@@ -247,26 +251,109 @@ template<typename T, std::size_t N> class Array
     std::array<T, N> d_;
 };
 
+/**
+ * @brief Default alignment of AlignedArray, enough for aligned AVX loads.
+ */
+constexpr std::size_t kArrayAlignment = 32;
+
+/**
+ * @brief Array whose elements start at an address aligned to Alignment.
+ *
+ * data() tells the compiler about the alignment, so loops over the elements,
+ * e.g. the algorithms of array_algorithms.h, can use aligned vector loads.
+ *
+ * @tparam Alignment a power of 2, at least alignof(T).
+ */
+template<typename T, std::size_t N, std::size_t Alignment = kArrayAlignment>
+class alignas(Alignment) AlignedArray : public Array<T, N>
+{
+    static_assert((Alignment & (Alignment - 1)) == 0,
+                  "Alignment must be a power of 2");
+    static_assert(Alignment >= alignof(T), "Alignment is too small for T");
+
+ public:
+    using typename Array<T, N>::pointer;
+    using typename Array<T, N>::const_pointer;
+
+    static constexpr std::size_t alignment = Alignment;
+
+    AlignedArray() = default;
+
+    using Array<T, N>::Array;
+
+    /**
+     * @brief Direct access to underlying array, aligned to Alignment.
+     *
+     */
+    constexpr pointer data() noexcept
+    {
+        return std::assume_aligned<Alignment>(Array<T, N>::data());
+    }
+
+    /**
+     * @brief Direct access to underlying array, aligned to Alignment.
+     *
+     */
+    constexpr const_pointer data() const noexcept
+    {
+        return std::assume_aligned<Alignment>(Array<T, N>::data());
+    }
+};
+
 /**
  * @brief Extracts the Ith element from the array.
  *
+ * I is checked at compile time, so there is no runtime bounds check.
+ *
  * @param a array whose contents to extract.
  */
 template<std::size_t I, class T, std::size_t N> constexpr T&
 get(Array<T, N>& a) noexcept
 {
-    return a.at(I);
+    static_assert(I < N, "Index out of bounds");
+    return a[I];
 }
 
 /**
  * @brief Extracts the Ith element from the array.
  *
+ * I is checked at compile time, so there is no runtime bounds check.
+ *
  * @param a array whose contents to extract.
  */
 template<std::size_t I, class T, std::size_t N> constexpr const T&
 get(const Array<T, N>& a) noexcept
 {
-    return a.at(I);
+    static_assert(I < N, "Index out of bounds");
+    return a[I];
+}
+
+/**
+ * @brief Moves the Ith element out of the array.
+ *
+ * I is checked at compile time, so there is no runtime bounds check.
+ *
+ * @param a array whose contents to extract.
+ */
+template<std::size_t I, class T, std::size_t N> constexpr T&&
+get(Array<T, N>&& a) noexcept
+{
+    static_assert(I < N, "Index out of bounds");
+    return std::move(a[I]);
+}
+
+/**
+ * @brief Extracts the Ith element from the array.
+ *
+ * I is checked at compile time, so there is no runtime bounds check.
+ *
+ * @param a array whose contents to extract.
+ */
+template<std::size_t I, class T, std::size_t N> constexpr const T&&
+get(const Array<T, N>&& a) noexcept
+{
+    static_assert(I < N, "Index out of bounds");
+    return std::move(a[I]);
 }
 
 /**
@@ -312,4 +399,31 @@ template<class T, std::size_t N> constexpr Array<std::remove_cv_t<T>, N>
 }
 }  // namespace ara::core
 
+/**
+ * @brief Tuple interface of Array, enabling structured bindings.
+ */
+template<typename T, std::size_t N>
+struct std::tuple_size<ara::core::Array<T, N>>
+  : std::integral_constant<std::size_t, N>
+{};
+
+template<typename T, std::size_t N, std::size_t Alignment>
+struct std::tuple_size<ara::core::AlignedArray<T, N, Alignment>>
+  : std::integral_constant<std::size_t, N>
+{};
+
+template<std::size_t I, typename T, std::size_t N>
+struct std::tuple_element<I, ara::core::Array<T, N>>
+{
+    static_assert(I < N, "Index out of bounds");
+    using type = T;
+};
+
+template<std::size_t I, typename T, std::size_t N, std::size_t Alignment>
+struct std::tuple_element<I, ara::core::AlignedArray<T, N, Alignment>>
+{
+    static_assert(I < N, "Index out of bounds");
+    using type = T;
+};
+
 #endif  // ARA_CORE_ARRAY_H_
@@ -0,0 +1,279 @@
+/**
+ * Copyright (c) 2020
+ * umlaut Software Development and contributors
+ *
+ * SPDX-License-Identifier: MIT
+ */
+#ifndef ARA_CORE_ARRAYALGORITHMS_H_
+#define ARA_CORE_ARRAYALGORITHMS_H_
+
+#include <algorithm>  // std::min
+#include <cstddef>    // std::size_t
+#include <memory>     // std::assume_aligned
+#include <type_traits>
+
+#include "ara/core/array.h"
+
+namespace ara::core {
+
+namespace internal {
+
+/**
+ * Element type, size and alignment of the arrays supported by the algorithms.
+ */
+template<typename ArrayT> struct ArrayTraits
+{};
+
+template<typename T, std::size_t N> struct ArrayTraits<Array<T, N>>
+{
+    using value_type                       = T;
+    static constexpr std::size_t size      = N;
+    static constexpr std::size_t alignment = alignof(Array<T, N>);
+};
+
+template<typename T, std::size_t N, std::size_t Alignment>
+struct ArrayTraits<AlignedArray<T, N, Alignment>>
+{
+    using value_type                       = T;
+    static constexpr std::size_t size      = N;
+    static constexpr std::size_t alignment = Alignment;
+};
+
+/**
+ * Array or AlignedArray of an arithmetic type.
+ */
+template<typename ArrayT> concept ArithmeticArray = std::is_arithmetic_v<
+  typename ArrayTraits<std::remove_cv_t<ArrayT>>::value_type>;
+
+/**
+ * Number of independent accumulators of a reduction, enough to fill a 256 bit
+ * vector register. Reducing into several accumulators breaks the dependency
+ * chain of a sequential loop, which is what allows the compiler to vectorize
+ * floating-point reductions without -ffast-math.
+ */
+template<typename ArrayT> constexpr std::size_t kReductionLanes =
+  std::min<std::size_t>(
+    std::max<std::size_t>(
+      32 / sizeof(typename ArrayTraits<ArrayT>::value_type), 1),
+    std::max<std::size_t>(ArrayTraits<ArrayT>::size, 1));
+
+/**
+ * Return the elements of the array, telling the compiler about its alignment.
+ */
+template<ArithmeticArray ArrayT> constexpr auto Elements(ArrayT& a) noexcept
+{
+    constexpr std::size_t alignment =
+      ArrayTraits<std::remove_cv_t<ArrayT>>::alignment;
+    return std::assume_aligned<alignment>(a.data());
+}
+
+/**
+ * Apply op to each pair of elements of a and b.
+ */
+template<ArithmeticArray ArrayT, typename Op> constexpr ArrayT
+Transform(ArrayT const& a, ArrayT const& b, Op op) noexcept
+{
+    constexpr std::size_t N = ArrayTraits<ArrayT>::size;
+
+    ArrayT     result{};
+    auto       r = Elements(result);
+    auto const x = Elements(a);
+    auto const y = Elements(b);
+    for (std::size_t i = 0; i < N; ++i) { r[i] = op(x[i], y[i]); }
+    return result;
+}
+
+/**
+ * Combine all elements of a with op, using kReductionLanes accumulators which
+ * are initialized with init.
+ */
+template<ArithmeticArray ArrayT, typename Op>
+constexpr typename ArrayTraits<ArrayT>::value_type
+Reduce(ArrayT const&                            a,
+       typename ArrayTraits<ArrayT>::value_type init,
+       Op                                       op) noexcept
+{
+    using T                 = typename ArrayTraits<ArrayT>::value_type;
+    constexpr std::size_t N = ArrayTraits<ArrayT>::size;
+    constexpr std::size_t L = kReductionLanes<ArrayT>;
+
+    T partial[L];
+    for (std::size_t j = 0; j < L; ++j) { partial[j] = init; }
+
+    auto const  x = Elements(a);
+    std::size_t i = 0;
+    for (; i + L <= N; i += L)
+    {
+        for (std::size_t j = 0; j < L; ++j)
+        {
+            partial[j] = op(partial[j], x[i + j]);
+        }
+    }
+    for (std::size_t j = 0; i + j < N; ++j)
+    {
+        partial[j] = op(partial[j], x[i + j]);
+    }
+
+    T result = partial[0];
+    for (std::size_t j = 1; j < L; ++j) { result = op(result, partial[j]); }
+    return result;
+}
+
+}  // namespace internal
+
+/**
+ * @brief Adds two arrays element-wise.
+ *
+ * The arithmetic is done as for a + b, converted back to the element type.
+ *
+ * @param a first array.
+ * @param b second array.
+ * @return the array of the sums.
+ */
+template<internal::ArithmeticArray ArrayT> constexpr ArrayT
+Add(ArrayT const& a, ArrayT const& b) noexcept
+{
+    using T = typename internal::ArrayTraits<ArrayT>::value_type;
+    return internal::Transform(
+      a, b, [](T x, T y) { return static_cast<T>(x + y); });
+}
+
+/**
+ * @brief Subtracts two arrays element-wise.
+ *
+ * @param a first array.
+ * @param b second array.
+ * @return the array of the differences.
+ */
+template<internal::ArithmeticArray ArrayT> constexpr ArrayT
+Subtract(ArrayT const& a, ArrayT const& b) noexcept
+{
+    using T = typename internal::ArrayTraits<ArrayT>::value_type;
+    return internal::Transform(
+      a, b, [](T x, T y) { return static_cast<T>(x - y); });
+}
+
+/**
+ * @brief Multiplies two arrays element-wise.
+ *
+ * @param a first array.
+ * @param b second array.
+ * @return the array of the products.
+ */
+template<internal::ArithmeticArray ArrayT> constexpr ArrayT
+Multiply(ArrayT const& a, ArrayT const& b) noexcept
+{
+    using T = typename internal::ArrayTraits<ArrayT>::value_type;
+    return internal::Transform(
+      a, b, [](T x, T y) { return static_cast<T>(x * y); });
+}
+
+/**
+ * @brief Multiplies each element of an array with a scalar.
+ *
+ * @param a the array.
+ * @param s the scalar.
+ * @return the array of the products.
+ */
+template<internal::ArithmeticArray ArrayT> constexpr ArrayT
+Scale(ArrayT const& a,
+      typename internal::ArrayTraits<ArrayT>::value_type s) noexcept
+{
+    using T = typename internal::ArrayTraits<ArrayT>::value_type;
+    return internal::Transform(
+      a, a, [s](T x, T) { return static_cast<T>(x * s); });
+}
+
+/**
+ * @brief Returns the sum of all elements.
+ *
+ * The sum is computed in the element type. For floating-point types the
+ * elements are added in kReductionLanes interleaved partial sums, so the
+ * result may differ from a sequential sum in the last bits.
+ *
+ * @param a the array.
+ */
+template<internal::ArithmeticArray ArrayT>
+constexpr typename internal::ArrayTraits<ArrayT>::value_type
+Sum(ArrayT const& a) noexcept
+{
+    using T = typename internal::ArrayTraits<ArrayT>::value_type;
+    return internal::Reduce(
+      a, T{}, [](T x, T y) { return static_cast<T>(x + y); });
+}
+
+/**
+ * @brief Returns the smallest element.
+ *
+ * @param a the array, which shall not be empty.
+ */
+template<internal::ArithmeticArray ArrayT>
+constexpr typename internal::ArrayTraits<ArrayT>::value_type
+Min(ArrayT const& a) noexcept
+{
+    using T = typename internal::ArrayTraits<ArrayT>::value_type;
+    static_assert(internal::ArrayTraits<ArrayT>::size > 0, "Array is empty");
+    return internal::Reduce(
+      a, a[0], [](T x, T y) { return y < x ? y : x; });
+}
+
+/**
+ * @brief Returns the largest element.
+ *
+ * @param a the array, which shall not be empty.
+ */
+template<internal::ArithmeticArray ArrayT>
+constexpr typename internal::ArrayTraits<ArrayT>::value_type
+Max(ArrayT const& a) noexcept
+{
+    using T = typename internal::ArrayTraits<ArrayT>::value_type;
+    static_assert(internal::ArrayTraits<ArrayT>::size > 0, "Array is empty");
+    return internal::Reduce(
+      a, a[0], [](T x, T y) { return x < y ? y : x; });
+}
+
+/**
+ * @brief Returns the dot product of two arrays.
+ *
+ * Computed like Sum(Multiply(a, b)), without storing the products.
+ *
+ * @param a first array.
+ * @param b second array.
+ */
+template<internal::ArithmeticArray ArrayT>
+constexpr typename internal::ArrayTraits<ArrayT>::value_type
+Dot(ArrayT const& a, ArrayT const& b) noexcept
+{
+    using Traits            = internal::ArrayTraits<ArrayT>;
+    using T                 = typename Traits::value_type;
+    constexpr std::size_t N = Traits::size;
+    constexpr std::size_t L = internal::kReductionLanes<ArrayT>;
+
+    T partial[L] = {};
+
+    auto const  x = internal::Elements(a);
+    auto const  y = internal::Elements(b);
+    std::size_t i = 0;
+    for (; i + L <= N; i += L)
+    {
+        for (std::size_t j = 0; j < L; ++j)
+        {
+            partial[j] = static_cast<T>(partial[j] + x[i + j] * y[i + j]);
+        }
+    }
+    for (std::size_t j = 0; i + j < N; ++j)
+    {
+        partial[j] = static_cast<T>(partial[j] + x[i + j] * y[i + j]);
+    }
+
+    T result = partial[0];
+    for (std::size_t j = 1; j < L; ++j)
+    {
+        result = static_cast<T>(result + partial[j]);
+    }
+    return result;
+}
+
+}  // namespace ara::core
+
+#endif  // ARA_CORE_ARRAYALGORITHMS_H_
@@ -0,0 +1,363 @@
+/**
+ * Copyright (c) 2020
+ * umlaut Software Development and contributors
+ *
+ * SPDX-License-Identifier: MIT
+ */
+#ifndef ARA_CORE_BITPACKING_H_
+#define ARA_CORE_BITPACKING_H_
+
+#include <array>
+#include <bit>      // std::endian
+#include <cstddef>  // std::size_t
+#include <cstdint>
+
+#include "ara/core/array.h"
+#include "ara/core/endian.h"
+#include "ara/core/span.h"
+#include "ara/core/utility.h"
+
+namespace ara::core {
+
+/**
+ * @brief Bit order of a signal inside a payload.
+ *
+ * Bits are numbered as in DBC files: bit i is bit i % 8 of byte i / 8, where
+ * bit 0 is the least significant bit of a byte.
+ */
+enum class BitOrder : std::uint8_t
+{
+    /**
+     * Little endian; the start bit is the least significant bit of the signal
+     * and the signal extends towards higher bit numbers.
+     */
+    kIntel,
+    /**
+     * Big endian; the start bit is the most significant bit of the signal and
+     * the signal extends towards lower bit numbers, continuing at bit 7 of the
+     * next byte.
+     */
+    kMotorola
+};
+
+namespace internal {
+
+constexpr std::uint64_t LowMask(std::size_t length) noexcept
+{
+    return length >= 64 ? ~std::uint64_t{0} : (std::uint64_t{1} << length) - 1;
+}
+
+/**
+ * Return the position of the most significant bit of a Motorola signal,
+ * counted from the most significant bit of the first byte.
+ */
+constexpr std::size_t MotorolaPosition(std::size_t startBit) noexcept
+{
+    return startBit / 8 * 8 + 7 - startBit % 8;
+}
+
+/**
+ * Load the 8 bytes at offset, padding bytes beyond the payload with zeros.
+ */
+template<std::endian Order> constexpr std::uint64_t
+LoadWindow(Span<Byte const> payload, std::size_t offset) noexcept
+{
+    if (offset + 8 <= payload.size())
+    {
+        return LoadInteger<std::uint64_t, Order>(
+          payload.subspan(offset).first<8>());
+    }
+    std::array<Byte, 8> window{};
+    for (std::size_t i = offset; i < payload.size(); ++i)
+    {
+        window[i - offset] = payload[i];
+    }
+    return LoadInteger<std::uint64_t, Order>(Span<Byte const, 8>{window});
+}
+
+/**
+ * Store 8 bytes at offset, dropping bytes beyond the payload.
+ */
+template<std::endian Order> constexpr void
+StoreWindow(std::uint64_t word, Span<Byte> payload, std::size_t offset) noexcept
+{
+    if (offset + 8 <= payload.size())
+    {
+        StoreInteger<Order>(word, payload.subspan(offset).first<8>());
+        return;
+    }
+    std::array<Byte, 8> window{};
+    StoreInteger<Order>(word, Span<Byte, 8>{window});
+    for (std::size_t i = offset; i < payload.size(); ++i)
+    {
+        payload[i] = window[i - offset];
+    }
+}
+
+}  // namespace internal
+
+/**
+ * @brief Reads signals at arbitrary bit positions of a payload.
+ *
+ * Each signal is extracted with one unaligned 64 bit load, a shift and a mask;
+ * only signals longer than 57 bits which straddle 9 bytes need one more byte.
+ */
+class BitReader final
+{
+ public:
+    /**
+     * @brief Construct a reader of the given payload.
+     *
+     * @param payload the bytes, which shall outlive the reader.
+     */
+    constexpr explicit BitReader(Span<Byte const> payload) noexcept
+      : payload{payload}
+    {}
+
+    /**
+     * @brief Returns the payload.
+     */
+    constexpr Span<Byte const> Payload() const noexcept { return payload; }
+
+    /**
+     * @brief Reads an unsigned signal.
+     *
+     * @param startBit the start bit of the signal, see BitOrder.
+     * @param length number of bits, 1 to 64; the signal shall lie within the
+     * payload.
+     * @param order the bit order of the signal.
+     * @return std::uint64_t the value of the signal.
+     */
+    constexpr std::uint64_t
+    Read(std::size_t startBit,
+         std::size_t length,
+         BitOrder    order = BitOrder::kIntel) const noexcept
+    {
+        if (order == BitOrder::kIntel)
+        {
+            std::size_t const byte  = startBit / 8;
+            std::size_t const shift = startBit % 8;
+            std::uint64_t     word =
+              internal::LoadWindow<std::endian::little>(payload, byte) >> shift;
+            if (shift + length > 64)
+            {
+                word |= to_integer<std::uint64_t>(payload[byte + 8])
+                        << (64 - shift);
+            }
+            return word & internal::LowMask(length);
+        }
+
+        std::size_t const position = internal::MotorolaPosition(startBit);
+        std::size_t const byte     = position / 8;
+        std::size_t const shift    = position % 8;
+        std::uint64_t     word =
+          internal::LoadWindow<std::endian::big>(payload, byte) << shift;
+        if (shift + length > 64)
+        {
+            word |= to_integer<std::uint64_t>(payload[byte + 8]) >> (8 - shift);
+        }
+        return word >> (64 - length);
+    }
+
+    /**
+     * @brief Reads a signed signal in two's complement.
+     *
+     * @param startBit the start bit of the signal, see BitOrder.
+     * @param length number of bits, 1 to 64.
+     * @param order the bit order of the signal.
+     * @return std::int64_t the sign-extended value of the signal.
+     */
+    constexpr std::int64_t
+    ReadSigned(std::size_t startBit,
+               std::size_t length,
+               BitOrder    order = BitOrder::kIntel) const noexcept
+    {
+        std::uint64_t const value = Read(startBit, length, order);
+        std::uint64_t const sign  = std::uint64_t{1} << (length - 1);
+        return static_cast<std::int64_t>((value ^ sign) - sign);
+    }
+
+ private:
+    Span<Byte const> payload;
+};
+
+/**
+ * @brief Writes signals at arbitrary bit positions of a payload.
+ *
+ * Each signal is inserted with one unaligned 64 bit read-modify-write; the
+ * bits around the signal are preserved.
+ */
+class BitWriter final
+{
+ public:
+    /**
+     * @brief Construct a writer of the given payload.
+     *
+     * @param payload the bytes, which shall outlive the writer.
+     */
+    constexpr explicit BitWriter(Span<Byte> payload) noexcept
+      : payload{payload}
+    {}
+
+    /**
+     * @brief Returns the payload.
+     */
+    constexpr Span<Byte> Payload() const noexcept { return payload; }
+
+    /**
+     * @brief Writes a signal.
+     *
+     * @param startBit the start bit of the signal, see BitOrder.
+     * @param length number of bits, 1 to 64; the signal shall lie within the
+     * payload.
+     * @param order the bit order of the signal.
+     * @param value the value; only the lowest length bits are written, so
+     * negative values are written in two's complement.
+     */
+    constexpr void Write(std::size_t   startBit,
+                         std::size_t   length,
+                         BitOrder      order,
+                         std::uint64_t value) const noexcept
+    {
+        std::uint64_t const mask = internal::LowMask(length);
+        value &= mask;
+
+        if (order == BitOrder::kIntel)
+        {
+            std::size_t const byte  = startBit / 8;
+            std::size_t const shift = startBit % 8;
+            std::uint64_t     word =
+              internal::LoadWindow<std::endian::little>(payload, byte);
+            word = (word & ~(mask << shift)) | (value << shift);
+            internal::StoreWindow<std::endian::little>(word, payload, byte);
+            if (shift + length > 64)
+            {
+                // the highest bits go to the low bits of the 9th byte
+                auto const spill = internal::LowMask(shift + length - 64);
+                auto const old   = to_integer<std::uint64_t>(payload[byte + 8]);
+                payload[byte + 8] = Byte{static_cast<std::uint8_t>(
+                  (old & ~spill) | ((value >> (64 - shift)) & spill))};
+            }
+            return;
+        }
+
+        std::size_t const   position = internal::MotorolaPosition(startBit);
+        std::size_t const   byte     = position / 8;
+        std::size_t const   shift    = position % 8;
+        std::uint64_t const aligned  = value << (64 - length);
+        std::uint64_t       word =
+          internal::LoadWindow<std::endian::big>(payload, byte);
+        word = (word & ~((mask << (64 - length)) >> shift))
+               | (aligned >> shift);
+        internal::StoreWindow<std::endian::big>(word, payload, byte);
+        if (shift + length > 64)
+        {
+            // the lowest bits go to the high bits of the 9th byte
+            auto const spill = ~internal::LowMask(72 - shift - length) & 0xFFu;
+            auto const old   = to_integer<std::uint64_t>(payload[byte + 8]);
+            payload[byte + 8] = Byte{static_cast<std::uint8_t>(
+              (old & ~spill) | (((aligned << (64 - shift)) >> 56) & spill))};
+        }
+    }
+
+    /**
+     * @brief Writes a signed signal in two's complement.
+     *
+     * @param startBit the start bit of the signal, see BitOrder.
+     * @param length number of bits, 1 to 64.
+     * @param order the bit order of the signal.
+     * @param value the value.
+     */
+    constexpr void WriteSigned(std::size_t  startBit,
+                               std::size_t  length,
+                               BitOrder     order,
+                               std::int64_t value) const noexcept
+    {
+        Write(startBit, length, order, static_cast<std::uint64_t>(value));
+    }
+
+ private:
+    Span<Byte> payload;
+};
+
+/**
+ * @brief Position, length and bit order of a signal in a frame.
+ *
+ * A structural type, so that it can describe a SignalLayout at compile time.
+ */
+struct Signal
+{
+    std::size_t startBit;
+    std::size_t length;
+    BitOrder    order = BitOrder::kIntel;
+
+    /**
+     * @brief Checks if the signal has 1 to 64 bits and lies within a frame of
+     * the given size.
+     */
+    constexpr bool FitsInto(std::size_t frameSize) const noexcept
+    {
+        std::size_t const first = order == BitOrder::kIntel
+                                    ? startBit
+                                    : internal::MotorolaPosition(startBit);
+        return length >= 1 && length <= 64 && first + length <= frameSize * 8;
+    }
+};
+
+/**
+ * @brief Compile-time description of the signals of a frame.
+ *
+ * Unpack and Pack process all signals in one pass over the frame. As all
+ * positions are constants, each signal compiles to a load, a shift and a mask
+ * with immediate operands.
+ *
+ * @tparam FrameSize size of the frame in bytes.
+ * @tparam Signals the signals, checked to fit into the frame.
+ */
+template<std::size_t FrameSize, Signal... Signals> struct SignalLayout
+{
+    static_assert((Signals.FitsInto(FrameSize) && ...),
+                  "Signal does not fit into the frame");
+
+    static constexpr std::size_t frameSize   = FrameSize;
+    static constexpr std::size_t signalCount = sizeof...(Signals);
+
+    /**
+     * @brief Raw values of all signals, in the order of Signals.
+     */
+    using Values = Array<std::uint64_t, sizeof...(Signals)>;
+
+    /**
+     * @brief Extracts all signals of a frame.
+     *
+     * @param frame the frame.
+     */
+    static constexpr Values Unpack(Span<Byte const, FrameSize> frame) noexcept
+    {
+        BitReader const reader{frame};
+        return Values{
+          reader.Read(Signals.startBit, Signals.length, Signals.order)...};
+    }
+
+    /**
+     * @brief Inserts all signals into a frame.
+     *
+     * Bits not covered by any signal are preserved.
+     *
+     * @param values the values, in the order of Signals.
+     * @param frame the frame.
+     */
+    static constexpr void
+    Pack(Values const& values, Span<Byte, FrameSize> frame) noexcept
+    {
+        BitWriter const writer{frame};
+        std::size_t     i = 0;
+        (writer.Write(
+           Signals.startBit, Signals.length, Signals.order, values[i++]),
+         ...);
+    }
+};
+
+}  // namespace ara::core
+
+#endif  // ARA_CORE_BITPACKING_H_
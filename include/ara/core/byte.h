@@ -9,6 +9,8 @@
 #define ARA_CORE_BYTE_H_
 
 #include <cstddef>
+#include <cstdint>  // uint8_t
+#include <type_traits>
 
 namespace ara::core {
 /**
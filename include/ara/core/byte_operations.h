@@ -0,0 +1,62 @@
+/**
+ * Copyright (c) 2020
+ * umlaut Software Development and contributors
+ *
+ * SPDX-License-Identifier: MIT
+ */
+#ifndef ARA_CORE_BYTEOPERATIONS_H_
+#define ARA_CORE_BYTEOPERATIONS_H_
+
+#include <cstddef>  // std::size_t
+
+#include "ara/core/span.h"
+#include "ara/core/utility.h"
+
+namespace ara::core {
+
+/**
+ * @brief Bitwise AND of two byte sequences, dst[i] &= src[i].
+ *
+ * Like the operators of ByteImpl applied to each byte, but processing 32 bytes
+ * per instruction on CPUs with AVX2, and 8 bytes otherwise. The kernel is
+ * selected at runtime.
+ *
+ * @param dst the bytes to modify.
+ * @param src the mask; only min(dst.size(), src.size()) bytes are processed.
+ */
+void AndBytes(Span<Byte> dst, Span<Byte const> src) noexcept;
+
+/**
+ * @brief Bitwise OR of two byte sequences, dst[i] |= src[i].
+ *
+ * @param dst the bytes to modify.
+ * @param src the mask; only min(dst.size(), src.size()) bytes are processed.
+ */
+void OrBytes(Span<Byte> dst, Span<Byte const> src) noexcept;
+
+/**
+ * @brief Bitwise XOR of two byte sequences, dst[i] ^= src[i].
+ *
+ * @param dst the bytes to modify.
+ * @param src the mask; only min(dst.size(), src.size()) bytes are processed.
+ */
+void XorBytes(Span<Byte> dst, Span<Byte const> src) noexcept;
+
+/**
+ * @brief Bit inversion of a byte sequence, bytes[i] = ~bytes[i].
+ *
+ * @param bytes the bytes to modify.
+ */
+void NotBytes(Span<Byte> bytes) noexcept;
+
+/**
+ * @brief Counts the set bits of a byte sequence.
+ *
+ * @param bytes the bytes to count.
+ * @return std::size_t number of bits set to 1.
+ */
+std::size_t PopCount(Span<Byte const> bytes) noexcept;
+
+}  // namespace ara::core
+
+#endif  // ARA_CORE_BYTEOPERATIONS_H_
@@ -0,0 +1,169 @@
+/**
+ * Copyright (c) 2020
+ * umlaut Software Development and contributors
+ *
+ * SPDX-License-Identifier: MIT
+ */
+#ifndef ARA_CORE_CHECKSUM_H_
+#define ARA_CORE_CHECKSUM_H_
+
+#include <cstdint>
+
+#include "ara/core/span.h"
+#include "ara/core/utility.h"
+
+namespace ara::core {
+
+namespace internal {
+
+/**
+ * Parameters and update kernel of a CRC algorithm. Update() advances the CRC
+ * register over data, before the final XOR is applied.
+ */
+struct Crc8SaeJ1850Traits
+{
+    using ValueType                   = std::uint8_t;
+    static constexpr ValueType init   = 0xFF;
+    static constexpr ValueType xorOut = 0xFF;
+    static ValueType Update(ValueType crc, Span<Byte const> data) noexcept;
+};
+
+struct Crc16CcittFalseTraits
+{
+    using ValueType                   = std::uint16_t;
+    static constexpr ValueType init   = 0xFFFF;
+    static constexpr ValueType xorOut = 0x0000;
+    static ValueType Update(ValueType crc, Span<Byte const> data) noexcept;
+};
+
+struct Crc32Traits
+{
+    using ValueType                   = std::uint32_t;
+    static constexpr ValueType init   = 0xFFFFFFFF;
+    static constexpr ValueType xorOut = 0xFFFFFFFF;
+    static ValueType Update(ValueType crc, Span<Byte const> data) noexcept;
+};
+
+struct Crc32CTraits
+{
+    using ValueType                   = std::uint32_t;
+    static constexpr ValueType init   = 0xFFFFFFFF;
+    static constexpr ValueType xorOut = 0xFFFFFFFF;
+    static ValueType Update(ValueType crc, Span<Byte const> data) noexcept;
+};
+
+/**
+ * Portable slicing-by-8 kernel of CRC-32C, which Crc32CTraits::Update uses on
+ * CPUs without SSE 4.2.
+ */
+std::uint32_t Crc32CUpdateSliced(std::uint32_t crc,
+                                 Span<Byte const> data) noexcept;
+
+struct Crc64XzTraits
+{
+    using ValueType                   = std::uint64_t;
+    static constexpr ValueType init   = 0xFFFFFFFFFFFFFFFF;
+    static constexpr ValueType xorOut = 0xFFFFFFFFFFFFFFFF;
+    static ValueType Update(ValueType crc, Span<Byte const> data) noexcept;
+};
+
+}  // namespace internal
+
+/**
+ * @brief Incremental CRC computation.
+ *
+ * Data may be passed in any number of Update() calls; the result only depends
+ * on the concatenation of all data. The kernels process 8 bytes per step with
+ * slicing-by-8 tables, or use the CRC32 instruction of SSE 4.2 for CRC-32C if
+ * the CPU supports it.
+ *
+ * @tparam Traits parameters and kernel of the algorithm.
+ */
+template<typename Traits> class Crc final
+{
+ public:
+    using ValueType = typename Traits::ValueType;
+
+    /**
+     * @brief Construct the CRC of no data.
+     */
+    constexpr Crc() noexcept = default;
+
+    /**
+     * @brief Computes the CRC of the given data in one step.
+     *
+     * @param data the data.
+     */
+    static ValueType Compute(Span<Byte const> data) noexcept
+    {
+        return Crc{}.Update(data).Value();
+    }
+
+    /**
+     * @brief Appends data.
+     *
+     * @param data the next chunk of data.
+     * @return Crc& this object.
+     */
+    Crc& Update(Span<Byte const> data) noexcept
+    {
+        crc = Traits::Update(crc, data);
+        return *this;
+    }
+
+    /**
+     * @brief Returns the CRC of all data passed so far.
+     */
+    constexpr ValueType Value() const noexcept
+    {
+        return static_cast<ValueType>(crc ^ Traits::xorOut);
+    }
+
+    /**
+     * @brief Restarts the computation, discarding all data.
+     */
+    constexpr void Reset() noexcept { crc = Traits::init; }
+
+ private:
+    ValueType crc = Traits::init;
+};
+
+/**
+ * @brief CRC-8 of SAE J1850, e.g. used by AUTOSAR E2E profile 1.
+ *
+ * Polynomial 0x1D, initial value and final XOR 0xFF, not reflected.
+ */
+using Crc8SaeJ1850 = Crc<internal::Crc8SaeJ1850Traits>;
+
+/**
+ * @brief CRC-16/CCITT-FALSE, e.g. used by AUTOSAR E2E profile 5.
+ *
+ * Polynomial 0x1021, initial value 0xFFFF, not reflected, no final XOR.
+ */
+using Crc16CcittFalse = Crc<internal::Crc16CcittFalseTraits>;
+
+/**
+ * @brief CRC-32 of IEEE 802.3, e.g. used by Ethernet and zlib.
+ *
+ * Polynomial 0x04C11DB7, reflected, initial value and final XOR 0xFFFFFFFF.
+ */
+using Crc32 = Crc<internal::Crc32Traits>;
+
+/**
+ * @brief CRC-32C (Castagnoli), e.g. used by iSCSI, SCTP and ext4.
+ *
+ * Polynomial 0x1EDC6F41, reflected, initial value and final XOR 0xFFFFFFFF.
+ */
+using Crc32C = Crc<internal::Crc32CTraits>;
+
+/**
+ * @brief CRC-64/XZ, also known as CRC-64/GO-ECMA.
+ *
+ * Polynomial 0x42F0E1EBA9EA3693, reflected, initial value and final XOR all
+ * ones.
+ */
+using Crc64Xz = Crc<internal::Crc64XzTraits>;
+
+}  // namespace ara::core
+
+#endif  // ARA_CORE_CHECKSUM_H_
@@ -7,9 +7,14 @@
 #ifndef ARA_CORE_COREERRORDOMAIN_H_
 #define ARA_CORE_COREERRORDOMAIN_H_
 
+#include <array>  // std::array
+
 #include "ara/core/error_code.h"
 #include "ara/core/error_domain.h"
 #include "ara/core/exception.h"
+#include "ara/core/fixed_string.h"
+#include "ara/core/static_error_domain.h"
+#include "ara/core/string_view.h"
 
 namespace ara::core {
 /**
@@ -20,12 +25,56 @@ namespace ara::core {
 enum class CoreErrc : ErrorDomain::CodeType {
     /** an invalid argument was passed to a function */
     kInvalidArgument = 22,
+    /** no element is available to be taken from a queue */
+    kQueueEmpty = 61,
+    /** no space is available to add an element to a queue */
+    kQueueFull = 105,
     /** given string is not a valid model element shortname */
     kInvalidMetaModelShortname = 137,
     /** missing or invalid path to model element */
     kInvalidMetaModelPath = 138
 };
 
+namespace internal {
+
+/**
+ * Lowest and highest CoreErrc value, bounds of the dense message table.
+ */
+constexpr auto coreErrcFirst =
+  static_cast<ErrorDomain::CodeType>(CoreErrc::kInvalidArgument);
+constexpr auto coreErrcLast =
+  static_cast<ErrorDomain::CodeType>(CoreErrc::kInvalidMetaModelPath);
+
+/**
+ * Messages of the CoreErrorDomain, indexed by CoreErrc value - coreErrcFirst.
+ */
+inline constexpr auto coreErrorMessages = [] {
+    std::array<StringView, coreErrcLast - coreErrcFirst + 1> messages{};
+    auto const at = [&messages](CoreErrc code) -> StringView& {
+        return messages[static_cast<std::size_t>(
+          static_cast<ErrorDomain::CodeType>(code) - coreErrcFirst)];
+    };
+    at(CoreErrc::kInvalidArgument) =
+      "an invalid argument was passed to a function";
+    at(CoreErrc::kQueueEmpty) =
+      "no element is available to be taken from a queue";
+    at(CoreErrc::kQueueFull) =
+      "no space is available to add an element to a queue";
+    at(CoreErrc::kInvalidMetaModelShortname) =
+      "given string is not a valid model element shortname";
+    at(CoreErrc::kInvalidMetaModelPath) =
+      "missing or invalid path to model element";
+    return messages;
+}();
+
+/**
+ * MessageTable of the CoreErrorDomain.
+ */
+inline constexpr ErrorDomain::MessageTable coreErrorMessageTable{
+  coreErrcFirst, coreErrorMessages, "Invalid code value"};
+
+}  // namespace internal
+
 /**
  * Exception type thrown for CORE errors.
  *
@@ -45,9 +94,14 @@ class CoreException : public Exception
 /**
  * An error domain for errors originating from the CORE Functional Cluster.
  *
+ * Name() (SWS_CORE_05242), Message() (SWS_CORE_05243) and ThrowAsException()
+ * (SWS_CORE_05244) are implemented by StaticErrorDomain, which also provides
+ * them without virtual dispatch as StaticName(), StaticMessage() and
+ * StaticThrowAsException().
+ *
  * @req {SWS_CORE_05221}
  */
-class CoreErrorDomain final : public ErrorDomain
+class CoreErrorDomain final : public StaticErrorDomain<CoreErrorDomain>
 {
     constexpr static IdType coreId = 0x8000000000000014;
 
@@ -67,37 +121,31 @@ class CoreErrorDomain final : public ErrorDomain
     using Exception = CoreException;
 
     /**
-     * Default constructor.
-     *
-     * @req {SWS_CORE_05241}
+     * The "shortname" ApApplicationErrorDomain.SN of this error domain, with
+     * its length known at compile time.
      */
-    constexpr CoreErrorDomain() noexcept : ErrorDomain{coreId} {}
+    constexpr static FixedString name{"Core"};
 
     /**
-     * Return the "shortname" ApApplicationErrorDomain.SN of this error domain.
-     *
-     * @return char const* "Core"
-     * @req {SWS_CORE_05242}
+     * The messages of all CoreErrc values.
      */
-    char const* Name() const noexcept override;
+    constexpr static ErrorDomain::MessageTable const& messageTable =
+      internal::coreErrorMessageTable;
 
     /**
-     * Translate an error code value into a text message.
+     * Default constructor.
      *
-     * @param errorCode the error code value
-     * @return char const* the text message, never nullptr
-     * @req {SWS_CORE_05243}
+     * @req {SWS_CORE_05241}
      */
-    char const*
-    Message(ErrorDomain::CodeType errorCode) const noexcept override;
+    constexpr CoreErrorDomain() noexcept : StaticErrorDomain{coreId} {}
+};
 
-    /**
-     * Throw the exception type corresponding to the given ErrorCode.
-     *
-     * @param errorCode the ErrorCode instance
-     * @req {SWS_CORE_05244}
-     */
-    void ThrowAsException(ErrorCode const& errorCode) const override;
+/**
+ * Resolve CoreErrc values to the CoreErrorDomain at compile time.
+ */
+template<> struct StaticErrorDomainOf<CoreErrc>
+{
+    using type = CoreErrorDomain;
 };
 
 /**
@@ -0,0 +1,240 @@
+/**
+ * Copyright (c) 2020
+ * umlaut Software Development and contributors
+ *
+ * SPDX-License-Identifier: MIT
+ */
+#ifndef ARA_CORE_ENDIAN_H_
+#define ARA_CORE_ENDIAN_H_
+
+#include <bit>       // std::endian
+#include <concepts>  // std::integral
+#include <cstddef>   // std::size_t
+#include <cstdint>
+#include <cstring>  // std::memcpy
+#include <type_traits>
+
+#include "ara/core/span.h"
+#include "ara/core/utility.h"
+
+namespace ara::core {
+
+/**
+ * @brief Reverses the byte order of an integer.
+ *
+ * Compiles to a single bswap (or rev, movbe) instruction.
+ *
+ * @param value the integer.
+ */
+template<std::integral T> constexpr T ByteSwap(T value) noexcept
+{
+    using U = std::make_unsigned_t<T>;
+    if constexpr (sizeof(T) == 1)
+    {
+        return value;
+    }
+    else if constexpr (sizeof(T) == 2)
+    {
+        return static_cast<T>(__builtin_bswap16(static_cast<U>(value)));
+    }
+    else if constexpr (sizeof(T) == 4)
+    {
+        return static_cast<T>(__builtin_bswap32(static_cast<U>(value)));
+    }
+    else
+    {
+        static_assert(sizeof(T) == 8, "Unsupported integer size");
+        return static_cast<T>(__builtin_bswap64(static_cast<U>(value)));
+    }
+}
+
+/**
+ * @brief Converts between native and the given byte order.
+ *
+ * The conversion is its own inverse, so it serves both directions.
+ *
+ * @tparam Order the byte order of the other side.
+ * @param value the integer.
+ */
+template<std::endian Order, std::integral T> constexpr T
+ConvertByteOrder(T value) noexcept
+{
+    static_assert(Order == std::endian::big || Order == std::endian::little,
+                  "Unsupported byte order");
+    if constexpr (Order == std::endian::native)
+    {
+        return value;
+    }
+    else
+    {
+        return ByteSwap(value);
+    }
+}
+
+/**
+ * @brief Reads an integer stored in the given byte order.
+ *
+ * At runtime this is a single unaligned load followed by a byte swap if the
+ * order differs from the native one.
+ *
+ * @tparam Order byte order of the stored integer.
+ * @param bytes the sizeof(T) bytes to read.
+ */
+template<std::integral T, std::endian Order> constexpr T
+LoadInteger(Span<Byte const, sizeof(T)> bytes) noexcept
+{
+    if (std::is_constant_evaluated())
+    {
+        using U = std::make_unsigned_t<T>;
+        U value = 0;
+        for (std::size_t i = 0; i < sizeof(T); ++i)
+        {
+            std::size_t const shift =
+              8 * (Order == std::endian::big ? sizeof(T) - 1 - i : i);
+            value |= static_cast<U>(to_integer<U>(bytes[i]) << shift);
+        }
+        return static_cast<T>(value);
+    }
+    T value;
+    std::memcpy(&value, static_cast<void const*>(bytes.data()), sizeof(T));
+    return ConvertByteOrder<Order>(value);
+}
+
+/**
+ * @brief Writes an integer in the given byte order.
+ *
+ * At runtime this is a byte swap if the order differs from the native one,
+ * followed by a single unaligned store.
+ *
+ * @tparam Order byte order to store the integer in.
+ * @param value the integer.
+ * @param bytes receives the sizeof(T) bytes.
+ */
+template<std::endian Order, std::integral T> constexpr void
+StoreInteger(T value, Span<Byte, sizeof(T)> bytes) noexcept
+{
+    if (std::is_constant_evaluated())
+    {
+        using U      = std::make_unsigned_t<T>;
+        auto const u = static_cast<U>(value);
+        for (std::size_t i = 0; i < sizeof(T); ++i)
+        {
+            std::size_t const shift =
+              8 * (Order == std::endian::big ? sizeof(T) - 1 - i : i);
+            bytes[i] = Byte{static_cast<std::uint8_t>(u >> shift)};
+        }
+        return;
+    }
+    T const ordered = ConvertByteOrder<Order>(value);
+    std::memcpy(static_cast<void*>(bytes.data()), &ordered, sizeof(T));
+}
+
+/**
+ * @brief Reads a big-endian (network byte order) integer.
+ *
+ * @param bytes the sizeof(T) bytes to read.
+ */
+template<std::integral T> constexpr T
+LoadBigEndian(Span<Byte const, sizeof(T)> bytes) noexcept
+{
+    return LoadInteger<T, std::endian::big>(bytes);
+}
+
+/**
+ * @brief Reads a little-endian integer.
+ *
+ * @param bytes the sizeof(T) bytes to read.
+ */
+template<std::integral T> constexpr T
+LoadLittleEndian(Span<Byte const, sizeof(T)> bytes) noexcept
+{
+    return LoadInteger<T, std::endian::little>(bytes);
+}
+
+/**
+ * @brief Writes a big-endian (network byte order) integer.
+ *
+ * @param value the integer.
+ * @param bytes receives the sizeof(T) bytes.
+ */
+template<std::integral T> constexpr void
+StoreBigEndian(T value, Span<Byte, sizeof(T)> bytes) noexcept
+{
+    StoreInteger<std::endian::big>(value, bytes);
+}
+
+/**
+ * @brief Writes a little-endian integer.
+ *
+ * @param value the integer.
+ * @param bytes receives the sizeof(T) bytes.
+ */
+template<std::integral T> constexpr void
+StoreLittleEndian(T value, Span<Byte, sizeof(T)> bytes) noexcept
+{
+    StoreInteger<std::endian::little>(value, bytes);
+}
+
+/**
+ * @brief Reads an array of consecutive integers stored in the given byte
+ * order.
+ *
+ * At runtime the whole array is copied at once and then swapped in place, a
+ * loop which the compiler vectorizes.
+ *
+ * @tparam Order byte order of the stored integers.
+ * @param bytes the stored integers; shall hold at least
+ * values.size() * sizeof(T) bytes.
+ * @param values receives the integers.
+ */
+template<std::endian Order, std::integral T> constexpr void
+LoadIntegers(Span<Byte const> bytes, Span<T> values) noexcept
+{
+    if (std::is_constant_evaluated())
+    {
+        for (std::size_t i = 0; i < values.size(); ++i)
+        {
+            values[i] = LoadInteger<T, Order>(
+              bytes.subspan(i * sizeof(T)).template first<sizeof(T)>());
+        }
+        return;
+    }
+    std::memcpy(values.data(),
+                static_cast<void const*>(bytes.data()),
+                values.size_bytes());
+    for (T& value : values) { value = ConvertByteOrder<Order>(value); }
+}
+
+/**
+ * @brief Writes an array of integers consecutively in the given byte order.
+ *
+ * @tparam Order byte order to store the integers in.
+ * @param values the integers.
+ * @param bytes receives the integers; shall hold at least
+ * values.size() * sizeof(T) bytes.
+ */
+template<std::endian Order, std::integral T> constexpr void
+StoreIntegers(Span<T const> values, Span<Byte> bytes) noexcept
+{
+    if (std::is_constant_evaluated())
+    {
+        for (std::size_t i = 0; i < values.size(); ++i)
+        {
+            StoreInteger<Order>(
+              values[i],
+              bytes.subspan(i * sizeof(T)).template first<sizeof(T)>());
+        }
+        return;
+    }
+    Byte* out = bytes.data();
+    for (T const value : values)
+    {
+        T const ordered = ConvertByteOrder<Order>(value);
+        std::memcpy(static_cast<void*>(out), &ordered, sizeof(T));
+        out += sizeof(T);
+    }
+}
+
+}  // namespace ara::core
+
+#endif  // ARA_CORE_ENDIAN_H_
@@ -7,13 +7,28 @@
 #ifndef ARA_CORE_ERRORCODE_H_
 #define ARA_CORE_ERRORCODE_H_
 
+#include <optional>
+#include <type_traits>
+
 #include "ara/core/error_domain.h"
 #include "ara/core/string_view.h"
 
+#ifdef ARA_CORE_ENABLE_ERROR_STATISTICS
+#    include "ara/core/error_statistics.h"
+#endif
+
 namespace ara::core {
 
 // forward declarations
 class ErrorDomain;
+class ErrorCode;
+
+namespace internal {
+constexpr ErrorCode
+RestoreErrorCode(ErrorDomain::CodeType        value,
+                 ErrorDomain const&           domain,
+                 ErrorDomain::SupportDataType data) noexcept;
+}  // namespace internal
 
 /**
  * Encapsulation of an error code.
@@ -30,20 +45,22 @@ class ErrorCode final
      * Construct a new ErrorCode instance with parameters.
      *
      * This constructor does not participate in overload resolution unless EnumT
-     * is an enum type.
+     * is an enum type. The ErrorCode is created by MakeErrorCode(e, data),
+     * found by argument-dependent lookup in the namespace of EnumT, so error
+     * constants can be created in constant expressions.
      *
      * @tparam EnumT an enum type that contains error code values.
      * @param e a domain-specific error code value.
      * @param data optional vendor-specific supplementary error context data.
      * @req {SWS_CORE_00512}
      */
-    template<typename EnumT>
+    template<typename EnumT,
+             typename = std::enable_if_t<std::is_enum_v<EnumT>>>
     constexpr ErrorCode(EnumT                        e,
                         ErrorDomain::SupportDataType data =
                           ErrorDomain::SupportDataType()) noexcept
-    {
-        *this = MakeErrorCode(e, data);
-    }
+      : ErrorCode{MakeErrorCode(e, data)}
+    {}
 
     /**
      * Construct a new ErrorCode instance with parameters.
@@ -58,7 +75,14 @@ class ErrorCode final
                         ErrorDomain::SupportDataType data =
                           ErrorDomain::SupportDataType()) noexcept
       : value{value}, domain{&domain}, data{data}
-    {}
+    {
+#ifdef ARA_CORE_ENABLE_ERROR_STATISTICS
+        if (! std::is_constant_evaluated())
+        {
+            internal::RecordErrorCreated(domain.Id(), value);
+        }
+#endif
+    }
 
     /**
      * Return the raw error code value.
@@ -94,10 +118,16 @@ class ErrorCode final
     /**
      * Return a textual representation of this ErrorCode.
      *
+     * For domains with a MessageTable this is a plain index into a static
+     * array, without a virtual call or a strlen.
+     *
      * @return StringView the error message text
      * @req {SWS_CORE_00518}
      */
-    StringView Message() const noexcept { return StringView(domain->Name()); }
+    constexpr StringView Message() const noexcept
+    {
+        return domain->MessageView(value);
+    }
 
     /**
      * Throw this error as exception.
@@ -110,6 +140,25 @@ class ErrorCode final
     void ThrowAsException() const { domain->ThrowAsException(*this); }
 
  private:
+    friend constexpr ErrorCode
+    internal::RestoreErrorCode(ErrorDomain::CodeType        value,
+                               ErrorDomain const&           domain,
+                               ErrorDomain::SupportDataType data) noexcept;
+
+    /**
+     * Selects the constructor for ErrorCodes restored from their serialized
+     * form, whose creation was counted where they were created.
+     */
+    struct Restored
+    {};
+
+    constexpr ErrorCode(ErrorDomain::CodeType        value,
+                        ErrorDomain const&           domain,
+                        ErrorDomain::SupportDataType data,
+                        Restored) noexcept
+      : value{value}, domain{&domain}, data{data}
+    {}
+
     /**
      * The domain-specific error code value.
      */
@@ -124,6 +173,21 @@ class ErrorCode final
     ErrorDomain::SupportDataType data;
 };
 
+namespace internal {
+
+/**
+ * Build an ErrorCode restored from its serialized form, which error
+ * statistics do not count as created.
+ */
+constexpr ErrorCode RestoreErrorCode(ErrorDomain::CodeType        value,
+                                     ErrorDomain const&           domain,
+                                     ErrorDomain::SupportDataType data) noexcept
+{
+    return ErrorCode{value, domain, data, ErrorCode::Restored{}};
+}
+
+}  // namespace internal
+
 /**
  * Global operator== for ErrorCode.
  *
@@ -0,0 +1,72 @@
+/**
+ * Copyright (c) 2020
+ * umlaut Software Development and contributors
+ *
+ * SPDX-License-Identifier: MIT
+ */
+#ifndef ARA_CORE_ERRORCODEWIRE_H_
+#define ARA_CORE_ERRORCODEWIRE_H_
+
+#include <cstddef>   // std::size_t
+#include <optional>  // std::optional
+
+#include "ara/core/error_code.h"
+#include "ara/core/error_domain.h"
+#include "ara/core/span.h"
+#include "ara/core/utility.h"
+
+namespace ara::core {
+
+/**
+ * Size of an ErrorCode in wire format: the domain Id (8 bytes), the code value
+ * (4 bytes) and the support data (4 bytes), each in little endian byte order.
+ */
+constexpr std::size_t kErrorCodeWireSize = 16;
+
+/**
+ * Encode an ErrorCode into wire format.
+ *
+ * @param code the ErrorCode to encode
+ * @param out receives the kErrorCodeWireSize bytes
+ */
+void EncodeErrorCode(ErrorCode const&               code,
+                     Span<Byte, kErrorCodeWireSize> out) noexcept;
+
+/**
+ * Decode an ErrorCode from wire format.
+ *
+ * The domain is looked up in the ErrorDomain registry.
+ *
+ * @param in the kErrorCodeWireSize bytes to decode
+ * @return std::optional<ErrorCode> the ErrorCode, or empty if its domain is
+ * not registered
+ */
+std::optional<ErrorCode>
+DecodeErrorCode(Span<Byte const, kErrorCodeWireSize> in) noexcept;
+
+/**
+ * Encode a sequence of ErrorCodes into consecutive records in wire format.
+ *
+ * @param codes the ErrorCodes to encode
+ * @param out receives the records; shall hold at least
+ * codes.size() * kErrorCodeWireSize bytes
+ * @return std::size_t number of bytes written
+ */
+std::size_t EncodeErrorCodes(Span<ErrorCode const> codes,
+                             Span<Byte>            out) noexcept;
+
+/**
+ * Decode a sequence of consecutive records in wire format.
+ *
+ * @param in the records to decode; trailing bytes not forming a complete
+ * record are ignored
+ * @param out receives the result of DecodeErrorCode for each record; shall
+ * hold at least in.size() / kErrorCodeWireSize elements
+ * @return std::size_t number of records whose domain was found
+ */
+std::size_t DecodeErrorCodes(Span<Byte const>               in,
+                             Span<std::optional<ErrorCode>> out) noexcept;
+
+}  // namespace ara::core
+
+#endif  // ARA_CORE_ERRORCODEWIRE_H_
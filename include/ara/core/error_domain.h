@@ -7,10 +7,12 @@
 #ifndef ARA_CORE_ERRORDOMAIN_H_
 #define ARA_CORE_ERRORDOMAIN_H_
 
+#include <cstddef>  // std::size_t
 #include <cstdint>  // uint64_t
 
-#include "ara/core/error_code.h"  // ErrorDomain
-#include "ara/exposition.h"       // IMPLEMENTATION_DEFINED
+#include "ara/core/span.h"         // Span
+#include "ara/core/string_view.h"  // StringView
+#include "ara/exposition.h"        // IMPLEMENTATION_DEFINED
 
 namespace ara::core {
 
@@ -51,6 +53,58 @@ class ErrorDomain
      */
     using SupportDataType = ara::exposition::SupportDataType_impl;
 
+    /**
+     * Dense table of the messages of an error domain, indexed by code value.
+     *
+     * Lets ErrorCode::Message() find the text of an error code with an index
+     * into a static array instead of a virtual call and a strlen. All texts
+     * shall be null-terminated, e.g. string literals.
+     */
+    class MessageTable final
+    {
+     public:
+        /**
+         * Construct a table of messages.
+         *
+         * @param first the code value of messages[0]
+         * @param messages the messages of the code values first,
+         * first + 1, ...; empty entries denote unused code values
+         * @param fallback the message of all unused code values
+         */
+        constexpr MessageTable(CodeType               first,
+                               Span<StringView const> messages,
+                               StringView             fallback) noexcept
+          : first{first}, messages{messages}, fallback{fallback}
+        {}
+
+        /**
+         * Return the message of the given code value.
+         *
+         * @param errorCode the domain-specific error code
+         * @return StringView the message, or the fallback message for unused
+         * code values
+         */
+        constexpr StringView Lookup(CodeType errorCode) const noexcept
+        {
+            if (errorCode < first)
+            {
+                return fallback;
+            }
+            auto const index = static_cast<std::size_t>(
+              static_cast<std::int64_t>(errorCode) - first);
+            if (index >= messages.size() || messages[index].empty())
+            {
+                return fallback;
+            }
+            return messages[index];
+        }
+
+     private:
+        CodeType               first;
+        Span<StringView const> messages;
+        StringView             fallback;
+    };
+
  protected:
     /**
      * Construct a new instance with the given identifier.
@@ -61,7 +115,20 @@ class ErrorDomain
      *
      * @req {SWS_CORE_00135}
      */
-    explicit constexpr ErrorDomain(IdType id) noexcept : id{id} {}
+    explicit constexpr ErrorDomain(IdType id) noexcept
+      : id{id}, messageTable{nullptr}
+    {}
+
+    /**
+     * Construct a new instance with the given identifier and a static table of
+     * its messages.
+     *
+     * @param id the unique identifier
+     * @param messages the messages of this domain, which shall outlive it
+     */
+    constexpr ErrorDomain(IdType id, MessageTable const& messages) noexcept
+      : id{id}, messageTable{&messages}
+    {}
 
     /**
      * Destructor.
@@ -167,6 +234,24 @@ class ErrorDomain
      */
     virtual char const* Message(CodeType errorCode) const noexcept = 0;
 
+    /**
+     * Return a textual representation of the given error code as StringView.
+     *
+     * Looks the text up in the MessageTable of this domain if it has one, and
+     * otherwise falls back to Message().
+     *
+     * @param errorCode the domain-specific error code
+     * @return StringView the text, null-terminated
+     */
+    constexpr StringView MessageView(CodeType errorCode) const noexcept
+    {
+        if (messageTable != nullptr)
+        {
+            return messageTable->Lookup(errorCode);
+        }
+        return StringView{Message(errorCode)};
+    }
+
     /**
      * Throw the given error as exception.
      *
@@ -185,6 +270,10 @@ class ErrorDomain
      * The unique domain identifier.
      */
     IdType id;
+    /**
+     * Optional static table of messages.
+     */
+    MessageTable const* messageTable;
 };
 }  // namespace ara::core
 
@@ -0,0 +1,95 @@
+/**
+ * Copyright (c) 2020
+ * umlaut Software Development and contributors
+ *
+ * SPDX-License-Identifier: MIT
+ */
+#ifndef ARA_CORE_ERRORDOMAINREGISTRY_H_
+#define ARA_CORE_ERRORDOMAINREGISTRY_H_
+
+#include <cstddef>   // std::size_t
+#include <optional>  // std::optional
+
+#include "ara/core/error_code.h"
+#include "ara/core/error_domain.h"
+
+namespace ara::core {
+
+/**
+ * Maximum number of error domains the process-wide registry can hold, in
+ * addition to the built-in CoreErrorDomain.
+ */
+constexpr std::size_t kMaxRegisteredErrorDomains = 128;
+
+/**
+ * Register an error domain in the process-wide registry, so that it can be
+ * found by its Id.
+ *
+ * The CoreErrorDomain is always registered. Registering a domain whose Id is
+ * already registered has no effect, as ErrorDomains with equal Ids compare
+ * equal.
+ *
+ * @param domain the domain, which shall have static storage duration
+ * @return true if a domain with the Id of domain is registered afterwards,
+ * false if the registry is full
+ */
+bool RegisterErrorDomain(ErrorDomain const& domain) noexcept;
+
+/**
+ * Find a registered error domain by its Id.
+ *
+ * This function is lock-free and takes constant time.
+ *
+ * @param id the Id of the domain
+ * @return ErrorDomain const* the domain, or nullptr if no domain with the
+ * given Id is registered
+ */
+ErrorDomain const* FindErrorDomain(ErrorDomain::IdType id) noexcept;
+
+/**
+ * Reconstruct an ErrorCode from its domain Id, e.g. after it was received
+ * from another process. Error statistics do not count it as created, as it
+ * was counted where it was created.
+ *
+ * @param domainId the Id of the domain of the error
+ * @param value the domain-specific error code value
+ * @param data the vendor-specific supplementary error context data
+ * @return std::optional<ErrorCode> the ErrorCode, or empty if no domain with
+ * the given Id is registered
+ */
+std::optional<ErrorCode>
+ReconstructErrorCode(ErrorDomain::IdType          domainId,
+                     ErrorDomain::CodeType        value,
+                     ErrorDomain::SupportDataType data) noexcept;
+
+/**
+ * Registers an error domain during static initialization.
+ *
+ * Define a namespace-scope object of this type next to the domain instance:
+ *
+ *     static ErrorDomainRegistration const registration{myErrorDomain};
+ */
+class ErrorDomainRegistration final
+{
+ public:
+    /**
+     * Register the given domain.
+     *
+     * @param domain the domain, which shall have static storage duration
+     */
+    explicit ErrorDomainRegistration(ErrorDomain const& domain) noexcept
+      : registered{RegisterErrorDomain(domain)}
+    {}
+
+    /**
+     * Check if the domain was registered.
+     */
+    bool Registered() const noexcept { return registered; }
+
+ private:
+    bool registered;
+};
+
+}  // namespace ara::core
+
+#endif  // ARA_CORE_ERRORDOMAINREGISTRY_H_
@@ -0,0 +1,136 @@
+/**
+ * Copyright (c) 2020
+ * umlaut Software Development and contributors
+ *
+ * SPDX-License-Identifier: MIT
+ */
+#ifndef ARA_CORE_ERRORSTATISTICS_H_
+#define ARA_CORE_ERRORSTATISTICS_H_
+
+/**
+ * Counting of ErrorCode creations and exception throws.
+ *
+ * Enabled by defining ARA_CORE_ENABLE_ERROR_STATISTICS, e.g. with the meson
+ * option error_statistics. When disabled, this header declares nothing, the
+ * counting hooks are compiled out completely and the implementation is not
+ * built.
+ */
+#ifdef ARA_CORE_ENABLE_ERROR_STATISTICS
+
+#    include <chrono>
+#    include <cstddef>  // std::size_t
+#    include <cstdint>  // uint64_t
+#    include <vector>
+
+#    include "ara/core/error_domain.h"
+
+namespace ara::core {
+
+/**
+ * Maximum number of distinct (domain, code) pairs which are counted. Errors
+ * seen after this limit is reached are not counted.
+ */
+constexpr std::size_t kMaxTrackedErrorCodes = 256;
+
+/**
+ * Counters of a single error code value of a single domain.
+ */
+struct ErrorStatisticsEntry
+{
+    /**
+     * Id of the domain; its name can be found via FindErrorDomain().
+     */
+    ErrorDomain::IdType domain;
+    /**
+     * The domain-specific error code value.
+     */
+    ErrorDomain::CodeType code;
+    /**
+     * Number of ErrorCodes constructed at runtime; copies and ErrorCodes
+     * restored by ReconstructErrorCode(), e.g. when received from another
+     * process, are not included.
+     */
+    std::uint64_t created;
+    /**
+     * Number of exceptions thrown for this error.
+     */
+    std::uint64_t thrown;
+};
+
+/**
+ * Counters of all errors seen by the process until a point in time.
+ */
+struct ErrorStatisticsSnapshot
+{
+    /**
+     * When the snapshot was taken.
+     */
+    std::chrono::steady_clock::time_point time;
+    /**
+     * One entry per error seen, ordered by domain Id and code value.
+     */
+    std::vector<ErrorStatisticsEntry> entries;
+};
+
+/**
+ * Rates of a single error code value of a single domain.
+ */
+struct ErrorRate
+{
+    ErrorDomain::IdType   domain;
+    ErrorDomain::CodeType code;
+    /**
+     * ErrorCodes constructed per second.
+     */
+    double created;
+    /**
+     * Exceptions thrown per second.
+     */
+    double thrown;
+};
+
+/**
+ * Aggregate the counters of all threads.
+ *
+ * The counters are not reset, so rates are obtained from the difference of two
+ * snapshots, see ErrorRates().
+ *
+ * @return ErrorStatisticsSnapshot the current counters
+ */
+ErrorStatisticsSnapshot TakeErrorStatisticsSnapshot();
+
+/**
+ * Compute the rate of each error between two snapshots.
+ *
+ * @param earlier the older snapshot
+ * @param later the newer snapshot
+ * @return std::vector<ErrorRate> one entry per error in later, ordered like
+ * later.entries; all rates are 0 if both snapshots were taken at the same time
+ */
+std::vector<ErrorRate> ErrorRates(ErrorStatisticsSnapshot const& earlier,
+                                  ErrorStatisticsSnapshot const& later);
+
+namespace internal {
+
+/**
+ * Count the creation of an ErrorCode. Wait-free once the error was seen
+ * before; the first count of an error may wait for another thread which
+ * claims a slot for an error on the same probe sequence.
+ */
+void RecordErrorCreated(ErrorDomain::IdType   domain,
+                        ErrorDomain::CodeType code) noexcept;
+
+/**
+ * Count the throw of an exception for an ErrorCode, with the progress
+ * guarantees of RecordErrorCreated().
+ */
+void RecordErrorThrown(ErrorDomain::IdType   domain,
+                       ErrorDomain::CodeType code) noexcept;
+
+}  // namespace internal
+
+}  // namespace ara::core
+
+#endif
+
+#endif  // ARA_CORE_ERRORSTATISTICS_H_
@@ -7,10 +7,12 @@
 #ifndef ARA_CORE_EXCEPTION_H_
 #define ARA_CORE_EXCEPTION_H_
 
+#include <cstddef>  // std::size_t
 #include <exception>
 
 #include "ara/core/error_code.h"
 #include "ara/core/error_domain.h"
+#include "ara/core/span.h"
 
 namespace ara::core {
 
@@ -18,6 +20,23 @@ namespace ara::core {
 class ErrorCode;
 class ErrorDomain;
 
+/**
+ * Whether exceptions capture the stack of their construction.
+ *
+ * Enabled by defining ARA_CORE_ENABLE_EXCEPTION_BACKTRACE, e.g. with the meson
+ * option exception_backtrace.
+ */
+#ifdef ARA_CORE_ENABLE_EXCEPTION_BACKTRACE
+constexpr bool kExceptionBacktraceEnabled = true;
+#else
+constexpr bool kExceptionBacktraceEnabled = false;
+#endif
+
+/**
+ * Maximum number of return addresses captured per exception.
+ */
+constexpr std::size_t kMaxStackTraceFrames = 32;
+
 /**
  * Base type for all AUTOSAR exception types.
  *
@@ -29,6 +48,8 @@ class Exception : public std::exception
     /**
      * Construct a new Exception object with a specific ErrorCode
      *
+     * The ErrorCode is copied, so err may be a temporary.
+     *
      * @param err the ErrorCode
      * @req {SWS_CORE_00611}
      */
@@ -41,6 +62,9 @@ class Exception : public std::exception
      * guarantees about the lifetime of the returned pointer that are given for
      * std::exception::what are preserved.
      *
+     * Returns the message of the embedded ErrorCode, which is owned by its
+     * ErrorDomain, so this function never allocates.
+     *
      * @return char const* a null-terminated string
      * @req {SWS_CORE_00612}
      */
@@ -54,11 +78,43 @@ class Exception : public std::exception
      */
     ErrorCode const& Error() const noexcept;
 
+    /**
+     * Return the return addresses captured when this exception was
+     * constructed, innermost first.
+     *
+     * The addresses are captured into the exception itself, without
+     * symbolization and without allocation.
+     *
+     * @return Span<void* const> the addresses; empty unless
+     * kExceptionBacktraceEnabled
+     */
+    Span<void* const> StackTrace() const noexcept;
+
+    /**
+     * Symbolize the captured return addresses and write them to a file
+     * descriptor, one frame per line.
+     *
+     * Symbolization only happens here, so it is paid for by the exceptions
+     * which are actually reported. Does nothing unless
+     * kExceptionBacktraceEnabled.
+     *
+     * @param fd the file descriptor to write to, e.g. 2 for stderr
+     */
+    void WriteStackTrace(int fd) const noexcept;
+
  private:
     /**
-     * The embedded ErrorCode.
+     * The embedded ErrorCode, held by value as the ErrorCode given to the
+     * constructor usually does not outlive the throw expression.
      */
-    ErrorCode const& error;
+    ErrorCode error;
+#ifdef ARA_CORE_ENABLE_EXCEPTION_BACKTRACE
+    /**
+     * The captured return addresses, of which stackTraceSize are valid.
+     */
+    void*       stackTrace[kMaxStackTraceFrames];
+    std::size_t stackTraceSize;
+#endif
 };
 
 }  // namespace ara::core
@@ -0,0 +1,140 @@
+/**
+ * Copyright (c) 2020
+ * umlaut Software Development and contributors
+ *
+ * SPDX-License-Identifier: MIT
+ */
+#ifndef ARA_CORE_FIXEDSTRING_H_
+#define ARA_CORE_FIXEDSTRING_H_
+
+#include <compare>
+#include <cstddef>  // std::size_t
+#include <cstdint>  // uint64_t
+
+#include "ara/core/internal/hash.h"
+#include "ara/core/string_view.h"
+
+namespace ara::core {
+
+/**
+ * @brief Null-terminated string of compile-time length.
+ *
+ * FixedString is a structural type, so it can be used as a non-type template
+ * parameter, and all operations are usable in constant expressions. Its length
+ * is part of the type, so no strlen is needed to view it as StringView.
+ *
+ * @tparam N number of characters, not counting the null terminator.
+ */
+template<std::size_t N> struct FixedString
+{
+    using value_type     = char;
+    using size_type      = std::size_t;
+    using const_pointer  = char const*;
+    using const_iterator = char const*;
+
+    /**
+     * @brief Construct a string of N null characters.
+     */
+    constexpr FixedString() noexcept = default;
+
+    /**
+     * @brief Construct from a string literal.
+     *
+     * Implicit, so that literals can be passed as template arguments.
+     *
+     * @param literal the null-terminated characters.
+     */
+    constexpr FixedString(char const (&literal)[N + 1]) noexcept
+    {
+        for (std::size_t i = 0; i < N; ++i) { value[i] = literal[i]; }
+    }
+
+    /**
+     * @brief Returns the number of characters.
+     */
+    static constexpr size_type size() noexcept { return N; }
+
+    /**
+     * @brief Checks whether the string is empty.
+     */
+    [[nodiscard]] static constexpr bool empty() noexcept { return N == 0; }
+
+    /**
+     * @brief Direct access to the null-terminated characters.
+     */
+    constexpr const_pointer data() const noexcept { return value; }
+
+    /**
+     * @brief Direct access to the null-terminated characters.
+     */
+    constexpr const_pointer c_str() const noexcept { return value; }
+
+    /**
+     * @brief Returns an iterator to the beginning.
+     */
+    constexpr const_iterator begin() const noexcept { return value; }
+
+    /**
+     * @brief Returns an iterator to the end.
+     */
+    constexpr const_iterator end() const noexcept { return value + N; }
+
+    /**
+     * @brief Access specified character.
+     *
+     * @param i position of the character to return.
+     */
+    constexpr char operator[](size_type i) const noexcept { return value[i]; }
+
+    /**
+     * @brief View the characters, without computing the length.
+     */
+    constexpr operator StringView() const noexcept
+    {
+        return StringView{value, N};
+    }
+
+    /**
+     * @brief Returns the FNV-1a hash of the characters.
+     */
+    constexpr std::uint64_t Hash() const noexcept
+    {
+        return internal::Fnv1a(StringView{*this});
+    }
+
+    /**
+     * @brief Checks if the contents of strings are equal.
+     *
+     * @param other the string to compare with.
+     */
+    template<std::size_t M> constexpr bool
+    operator==(FixedString<M> const& other) const noexcept
+    {
+        return StringView{*this} == StringView{other};
+    }
+
+    /**
+     * @brief Compares the contents of strings lexicographically.
+     *
+     * @param other the string to compare with.
+     */
+    template<std::size_t M> constexpr std::strong_ordering
+    operator<=>(FixedString<M> const& other) const noexcept
+    {
+        return StringView{*this} <=> StringView{other};
+    }
+
+    /**
+     * @brief The characters, public so that the type stays structural.
+     */
+    char value[N + 1] = {};
+};
+
+/**
+ * @brief Deduce the length from a string literal.
+ */
+template<std::size_t N> FixedString(char const (&)[N]) -> FixedString<N - 1>;
+
+}  // namespace ara::core
+
+#endif  // ARA_CORE_FIXEDSTRING_H_
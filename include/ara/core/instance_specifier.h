@@ -0,0 +1,247 @@
+/**
+ * Copyright (c) 2020
+ * umlaut Software Development and contributors
+ *
+ * SPDX-License-Identifier: MIT
+ */
+#ifndef ARA_CORE_INSTANCESPECIFIER_H_
+#define ARA_CORE_INSTANCESPECIFIER_H_
+
+#include <cstddef>  // std::size_t
+#include <cstdint>  // uint64_t
+#include <functional>
+#include <type_traits>
+
+#include "ara/core/internal/hash.h"
+#include "ara/core/metamodel_validation.h"
+#include "ara/core/string_interner.h"
+#include "ara/core/string_view.h"
+
+namespace ara::core {
+
+/**
+ * Class representing an AUTOSAR Instance Specifier, which is basically an
+ * AUTOSAR shortname-path wrapper.
+ *
+ * Paths created at runtime are interned in StringInterner::Global(), so two
+ * interned InstanceSpecifiers compare equal exactly if they refer to the same
+ * characters, and the hash of the path is computed only once. Paths created in
+ * a constant expression refer to the given literal and are validated at
+ * compile time.
+ *
+ * The constructor throws for an invalid path; to create an InstanceSpecifier
+ * without exceptions, check the path with ValidateMetaModelPath() first.
+ *
+ * @req {SWS_CORE_08001}
+ */
+class InstanceSpecifier final
+{
+ public:
+    /**
+     * Throwing ctor from meta-model string.
+     *
+     * @param metaModelIdentifier stringified meta model identifier (short name
+     * path) where path separator is '/'. Lifetime of underlying string has to
+     * exceed the lifetime of the constructed InstanceSpecifier if created in a
+     * constant expression.
+     * @throws CoreException in case the given metaModelIdentifier is not a
+     * valid meta-model identifier/short name path
+     *
+     * @req {SWS_CORE_08021}
+     */
+    explicit constexpr InstanceSpecifier(StringView metaModelIdentifier)
+      : path{metaModelIdentifier}, hash{0}, interned{false}
+    {
+        if (auto const error = ValidateMetaModelPath(metaModelIdentifier))
+        {
+            error->ThrowAsException();
+        }
+        if (std::is_constant_evaluated())
+        {
+            hash = internal::Fnv1a(path);
+        }
+        else
+        {
+            auto const entry = StringInterner::Global().Intern(path);
+            path             = entry.View();
+            hash             = entry.Hash();
+            interned         = true;
+        }
+    }
+
+    /**
+     * Copy constructor.
+     *
+     * @req {SWS_CORE_08022}
+     */
+    constexpr InstanceSpecifier(InstanceSpecifier const& other) = default;
+
+    /**
+     * Move constructor.
+     *
+     * @req {SWS_CORE_08023}
+     */
+    constexpr InstanceSpecifier(InstanceSpecifier&& other) noexcept = default;
+
+    /**
+     * Copy assignment operator.
+     *
+     * @req {SWS_CORE_08024}
+     */
+    constexpr InstanceSpecifier&
+    operator=(InstanceSpecifier const& other) = default;
+
+    /**
+     * Move assignment operator.
+     *
+     * @req {SWS_CORE_08025}
+     */
+    constexpr InstanceSpecifier&
+    operator=(InstanceSpecifier&& other) noexcept = default;
+
+    /**
+     * Destructor.
+     *
+     * @req {SWS_CORE_08029}
+     */
+    ~InstanceSpecifier() = default;
+
+    /**
+     * Method to return the stringified form of InstanceSpecifier.
+     *
+     * @return StringView stringified form of InstanceSpecifier. Lifetime of
+     * the underlying string is only guaranteed for the lifetime of the
+     * underlying string of the StringView passed to the constructor, or for
+     * the lifetime of the process if the InstanceSpecifier was created at
+     * runtime.
+     *
+     * @req {SWS_CORE_08041}
+     */
+    constexpr StringView ToString() const noexcept { return path; }
+
+    /**
+     * Return the precomputed hash of the path.
+     *
+     * @return std::uint64_t the FNV-1a hash of ToString()
+     */
+    constexpr std::uint64_t Hash() const noexcept { return hash; }
+
+    /**
+     * Equality comparison operator.
+     *
+     * Two InstanceSpecifiers created at runtime are compared by the address of
+     * their interned path only.
+     *
+     * @param other InstanceSpecifier instance to compare this one with
+     * @return true in case both InstanceSpecifiers are denoting exactly the
+     * same model element, false else
+     *
+     * @req {SWS_CORE_08042}
+     */
+    constexpr bool operator==(InstanceSpecifier const& other) const noexcept
+    {
+        if (std::is_constant_evaluated())
+        {
+            return path == other.path;
+        }
+        if (path.data() == other.path.data())
+        {
+            return path.size() == other.path.size();
+        }
+        if (interned && other.interned)
+        {
+            return false;
+        }
+        return hash == other.hash && path == other.path;
+    }
+
+    /**
+     * Equality comparison operator.
+     *
+     * @param other string representation to compare this one with
+     * @return true in case this InstanceSpecifiers is denoting exactly the
+     * same model element as other, false else
+     *
+     * @req {SWS_CORE_08043}
+     */
+    constexpr bool operator==(StringView other) const noexcept
+    {
+        return path == other;
+    }
+
+    /**
+     * Non-equality comparison operator.
+     *
+     * @param other InstanceSpecifier instance to compare this one with
+     * @return false in case both InstanceSpecifiers are denoting exactly the
+     * same model element, true else
+     *
+     * @req {SWS_CORE_08044}
+     */
+    constexpr bool operator!=(InstanceSpecifier const& other) const noexcept
+    {
+        return ! (*this == other);
+    }
+
+    /**
+     * Non-equality comparison operator.
+     *
+     * @param other string representation to compare this one with
+     * @return false in case this InstanceSpecifiers is denoting exactly the
+     * same model element as other, true else
+     *
+     * @req {SWS_CORE_08045}
+     */
+    constexpr bool operator!=(StringView other) const noexcept
+    {
+        return ! (*this == other);
+    }
+
+    /**
+     * Lower than comparison operator.
+     *
+     * @param other InstanceSpecifier instance to compare this one with
+     * @return true in case this InstanceSpecifiers is lexically lower than
+     * other, false else
+     *
+     * @req {SWS_CORE_08046}
+     */
+    constexpr bool operator<(InstanceSpecifier const& other) const noexcept
+    {
+        return path < other.path;
+    }
+
+ private:
+    /**
+     * The meta-model path, interned if created at runtime.
+     */
+    StringView path;
+    /**
+     * Hash of the meta-model path.
+     */
+    std::uint64_t hash;
+    /**
+     * Whether path points into the global string table.
+     */
+    bool interned;
+};
+
+}  // namespace ara::core
+
+namespace std {
+
+/**
+ * Hash support for InstanceSpecifier, using the precomputed hash value.
+ */
+template<> struct hash<ara::core::InstanceSpecifier>
+{
+    std::size_t
+    operator()(ara::core::InstanceSpecifier const& instance) const noexcept
+    {
+        return instance.Hash();
+    }
+};
+
+}  // namespace std
+
+#endif  // ARA_CORE_INSTANCESPECIFIER_H_
@@ -0,0 +1,26 @@
+/**
+ * Copyright (c) 2020
+ * umlaut Software Development and contributors
+ *
+ * SPDX-License-Identifier: MIT
+ */
+#ifndef ARA_CORE_INTERNAL_CACHELINE_H_
+#define ARA_CORE_INTERNAL_CACHELINE_H_
+
+#include <cstddef>  // std::size_t
+
+namespace ara::core::internal {
+
+/**
+ * Alignment which keeps data written by different threads on different cache
+ * lines.
+ *
+ * A constant rather than std::hardware_destructive_interference_size, whose
+ * value may differ between translation units compiled for different targets
+ * and so must not affect the layout of types in headers.
+ */
+constexpr std::size_t kCacheLineSize = 64;
+
+}  // namespace ara::core::internal
+
+#endif  // ARA_CORE_INTERNAL_CACHELINE_H_
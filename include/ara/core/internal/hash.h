@@ -0,0 +1,38 @@
+/**
+ * Copyright (c) 2020
+ * umlaut Software Development and contributors
+ *
+ * SPDX-License-Identifier: MIT
+ */
+#ifndef ARA_CORE_INTERNAL_HASH_H_
+#define ARA_CORE_INTERNAL_HASH_H_
+
+#include <cstdint>  // uint64_t
+
+#include "ara/core/string_view.h"
+
+namespace ara::core::internal {
+
+/**
+ * 64-bit FNV-1a hash of a string.
+ *
+ * Usable in constant expressions, so hashes of literal identifiers can be
+ * computed at compile time and match the ones computed at runtime.
+ *
+ * @param s the string to hash
+ * @return std::uint64_t the hash value
+ */
+constexpr std::uint64_t Fnv1a(StringView s) noexcept
+{
+    std::uint64_t hash = 0xcbf29ce484222325u;
+    for (char const c : s)
+    {
+        hash ^= static_cast<unsigned char>(c);
+        hash *= 0x100000001b3u;
+    }
+    return hash;
+}
+
+}  // namespace ara::core::internal
+
+#endif  // ARA_CORE_INTERNAL_HASH_H_
@@ -68,9 +68,8 @@ class Map
      * container.
      */
     explicit Map(const C& comp, const Allocator& alloc = Allocator())
-    {
-        m_ = std::map<K, V, C, Allocator>(comp, alloc);
-    }
+      : m_(comp, alloc)
+    {}
 
     /**
      * @brief Constructs an empty container.
@@ -78,10 +77,7 @@ class Map
      * @param alloc allocator to use for all memory allocations of this
      * container.
      */
-    explicit Map(const Allocator& alloc)
-    {
-        m_ = std::map<K, V, C, Allocator>(alloc);
-    }
+    explicit Map(const Allocator& alloc) : m_(alloc) {}
 
     /**
      * @brief Copy constructor. Constructs the container with the copy of the
@@ -90,7 +86,7 @@ class Map
      * @param other another container to be used as source to initialize the
      * elements of the container with.
      */
-    Map(const Map& other) { m_ = std::map<K, V, C, Allocator>(other.m_); }
+    Map(const Map& other) : m_(other.m_) {}
 
     /**
      * @brief Copy constructor. Constructs the container with the copy of the
@@ -101,10 +97,7 @@ class Map
      * @param alloc allocator to use for all memory allocations of this
      * container.
      */
-    Map(const Map& other, const Allocator& alloc)
-    {
-        m_ = std::map<K, V, C, Allocator>(other.m_, alloc);
-    }
+    Map(const Map& other, const Allocator& alloc) : m_(other.m_, alloc) {}
 
     /**
      * @brief Move constructor. Constructs the container with the contents of
@@ -113,10 +106,7 @@ class Map
      * @param other another container to be used as source to initialize the
      * elements of the container with.
      */
-    Map(const Map&& other)
-    {
-        m_ = std::map<K, V, C, Allocator>(std::move(other.m_));
-    }
+    Map(const Map&& other) : m_(std::move(other.m_)) {}
 
     /**
      * @brief Move constructor. Constructs the container with the contents of
@@ -128,9 +118,8 @@ class Map
      * container.
      */
     Map(const Map&& other, const Allocator& alloc)
-    {
-        m_ = std::map<K, V, C, Allocator>(std::move(other.m_), alloc);
-    }
+      : m_(std::move(other.m_), alloc)
+    {}
 
     /**
      * @brief Constructs the container with the contents of the initializer list
@@ -146,9 +135,8 @@ class Map
     Map(std::initializer_list<value_type> init,
         const C&                          comp  = C(),
         const Allocator&                  alloc = Allocator())
-    {
-        m_ = std::map<K, V, C, Allocator>(init, comp, alloc);
-    }
+      : m_(init, comp, alloc)
+    {}
 
     /**
      * @brief Replaces the contents of the container.
@@ -0,0 +1,210 @@
+/**
+ * Copyright (c) 2020
+ * umlaut Software Development and contributors
+ *
+ * SPDX-License-Identifier: MIT
+ */
+#ifndef ARA_CORE_METAMODELVALIDATION_H_
+#define ARA_CORE_METAMODELVALIDATION_H_
+
+#include <algorithm>  // std::min
+#include <cstddef>    // std::size_t
+#include <optional>   // std::optional
+#include <type_traits>
+
+#include "ara/core/core_error_domain.h"
+#include "ara/core/error_code.h"
+#include "ara/core/span.h"
+#include "ara/core/string_view.h"
+
+namespace ara::core {
+
+/**
+ * Maximum number of characters of a single model element shortname.
+ */
+constexpr std::size_t kMaxShortnameLength = 128;
+
+namespace internal {
+
+/**
+ * Check if the character may start a shortname, i.e. is a letter.
+ */
+constexpr bool IsShortnameStart(char c) noexcept
+{
+    return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z');
+}
+
+/**
+ * Check if the character may appear inside a shortname.
+ */
+constexpr bool IsShortnameChar(char c) noexcept
+{
+    return IsShortnameStart(c) || (c >= '0' && c <= '9') || c == '_';
+}
+
+/**
+ * Scalar variant of FindInvalidPathChar, usable in constant expressions.
+ *
+ * @param s the characters to scan
+ * @param n number of characters to scan
+ * @return std::size_t offset of the first character which is neither a
+ * shortname character nor '/', or n if there is none
+ */
+constexpr std::size_t
+FindInvalidPathCharScalar(char const* s, std::size_t n) noexcept
+{
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        if (! IsShortnameChar(s[i]) && s[i] != '/')
+        {
+            return i;
+        }
+    }
+    return n;
+}
+
+/**
+ * Vectorized character-class kernel behind path and shortname validation.
+ *
+ * Scans 16 characters per iteration where SIMD is available and falls back to
+ * FindInvalidPathCharScalar otherwise.
+ *
+ * @param s the characters to scan
+ * @param n number of characters to scan
+ * @return std::size_t offset of the first character which is neither a
+ * shortname character nor '/', or n if there is none
+ */
+std::size_t FindInvalidPathChar(char const* s, std::size_t n) noexcept;
+
+/**
+ * Select the vectorized kernel at runtime and the scalar one at compile time.
+ */
+constexpr std::size_t FindInvalidPathChar(StringView s) noexcept
+{
+    if (std::is_constant_evaluated())
+    {
+        return FindInvalidPathCharScalar(s.data(), s.size());
+    }
+    return FindInvalidPathChar(s.data(), s.size());
+}
+
+/**
+ * Create an ErrorCode of the CoreErrorDomain, carrying the offset of the
+ * offending character as support data.
+ */
+constexpr ErrorCode
+MakeValidationError(CoreErrc code, std::size_t offset) noexcept
+{
+    return MakeErrorCode(code,
+                         static_cast<ErrorDomain::SupportDataType>(offset));
+}
+
+/**
+ * Validate a single path element, given the result of the character-class
+ * kernel for the whole path.
+ *
+ * @param path the full path
+ * @param begin offset of the first character of the element
+ * @param end offset one past the last character of the element
+ * @param invalid offset of the first invalid character in path
+ */
+constexpr std::optional<ErrorCode>
+ValidatePathElement(StringView  path,
+                    std::size_t begin,
+                    std::size_t end,
+                    std::size_t invalid) noexcept
+{
+    if (begin == end)
+    {
+        return MakeValidationError(CoreErrc::kInvalidMetaModelPath, begin);
+    }
+    if (! IsShortnameStart(path[begin]))
+    {
+        return MakeValidationError(CoreErrc::kInvalidMetaModelShortname,
+                                   begin);
+    }
+    if (invalid < end)
+    {
+        return MakeValidationError(CoreErrc::kInvalidMetaModelShortname,
+                                   invalid);
+    }
+    if (end - begin > kMaxShortnameLength)
+    {
+        return MakeValidationError(CoreErrc::kInvalidMetaModelShortname,
+                                   begin + kMaxShortnameLength);
+    }
+    return std::nullopt;
+}
+
+}  // namespace internal
+
+/**
+ * Check if the given string is a valid model element shortname.
+ *
+ * A shortname starts with a letter, followed by letters, digits or
+ * underscores, and is at most kMaxShortnameLength characters long.
+ *
+ * @param shortname the string to check
+ * @return std::optional<ErrorCode> empty if shortname is valid, otherwise
+ * CoreErrc::kInvalidMetaModelShortname with the offset of the offending
+ * character as support data
+ */
+constexpr std::optional<ErrorCode>
+ValidateShortname(StringView shortname) noexcept
+{
+    if (shortname.empty())
+    {
+        return internal::MakeValidationError(
+          CoreErrc::kInvalidMetaModelShortname, 0);
+    }
+    std::size_t const invalid = std::min(
+      internal::FindInvalidPathChar(shortname), shortname.find('/'));
+    return internal::ValidatePathElement(
+      shortname, 0, shortname.size(), invalid);
+}
+
+/**
+ * Check if the given string is a valid path to a model element.
+ *
+ * A path consists of one or more shortnames separated by single '/'
+ * characters, e.g. "Executable/RootComponent/Port".
+ *
+ * @param path the string to check
+ * @return std::optional<ErrorCode> empty if path is valid, otherwise
+ * CoreErrc::kInvalidMetaModelPath if the path is empty or has an empty element,
+ * or CoreErrc::kInvalidMetaModelShortname if an element is not a valid
+ * shortname. The support data holds the offset of the offending character.
+ */
+constexpr std::optional<ErrorCode>
+ValidateMetaModelPath(StringView path) noexcept
+{
+    std::size_t const invalid = internal::FindInvalidPathChar(path);
+    std::size_t       begin   = 0;
+    while (true)
+    {
+        std::size_t const end = std::min(path.find('/', begin), path.size());
+        auto const error = internal::ValidatePathElement(
+          path, begin, end, invalid);
+        if (error || end == path.size())
+        {
+            return error;
+        }
+        begin = end + 1;
+    }
+}
+
+/**
+ * Validate a batch of model element paths in one call.
+ *
+ * @param paths the paths to check
+ * @param results receives the result of ValidateMetaModelPath for each path;
+ * shall hold at least paths.size() elements
+ * @return std::size_t number of invalid paths
+ */
+std::size_t
+ValidateMetaModelPaths(Span<StringView const>         paths,
+                       Span<std::optional<ErrorCode>> results) noexcept;
+
+}  // namespace ara::core
+
+#endif  // ARA_CORE_METAMODELVALIDATION_H_
@@ -0,0 +1,283 @@
+/**
+ * Copyright (c) 2020
+ * umlaut Software Development and contributors
+ *
+ * SPDX-License-Identifier: MIT
+ */
+#ifndef ARA_CORE_MPMCQUEUE_H_
+#define ARA_CORE_MPMCQUEUE_H_
+
+#include <algorithm>  // std::clamp, std::min
+#include <atomic>
+#include <bit>      // std::bit_ceil
+#include <cstddef>  // std::size_t
+#include <cstdint>
+#include <memory>  // std::unique_ptr
+#include <new>     // std::launder
+#include <optional>
+#include <utility>  // std::move
+
+#include "ara/core/core_error_domain.h"
+#include "ara/core/error_code.h"
+#include "ara/core/internal/cache_line.h"
+
+namespace ara::core {
+
+/**
+ * @brief Bounded lock-free queue from any number of producer threads to any
+ * number of consumer threads.
+ *
+ * Every slot carries a sequence number which tells producers and consumers
+ * whether it is free or filled for their current position (D. Vyukov's
+ * bounded MPMC queue), so an operation is one compare-and-swap of a position
+ * and one store of a sequence number, and operations on different slots do
+ * not contend. Slots are allocated once by the constructor.
+ *
+ * TryPush() and TryPop() never block. Push() and Pop() wait for a free or
+ * filled slot with std::atomic::wait, which sleeps in the kernel (a futex on
+ * Linux) instead of spinning.
+ *
+ * Moving an element shall not throw; std::terminate is called otherwise.
+ *
+ * @tparam T the element type; move constructible.
+ */
+template<typename T> class MpmcQueue final
+{
+ public:
+    using value_type = T;
+    using size_type  = std::size_t;
+
+    /**
+     * @brief Maximum capacity: positions are 32 bit numbers compared by their
+     * signed difference, which must stay below 2^31 even for a stale position
+     * that finds its slot one lap ahead.
+     */
+    static constexpr size_type kMaxCapacity = size_type{1} << 30;
+
+    /**
+     * @brief Construct an empty queue.
+     *
+     * @param capacity the minimum number of elements; rounded up to a power
+     * of 2 of at least 2, and clamped to kMaxCapacity.
+     */
+    explicit MpmcQueue(size_type capacity)
+        : mask_{std::bit_ceil(std::clamp<size_type>(capacity, 2, kMaxCapacity))
+                - 1},
+          slots_{new Slot[mask_ + 1]}
+    {
+        for (size_type i = 0; i <= mask_; ++i)
+        {
+            slots_[i].sequence.store(static_cast<Sequence>(i),
+                                     std::memory_order_relaxed);
+        }
+    }
+
+    MpmcQueue(MpmcQueue const&) = delete;
+    MpmcQueue& operator=(MpmcQueue const&) = delete;
+
+    /**
+     * @brief Destroy the elements left in the queue.
+     */
+    ~MpmcQueue()
+    {
+        Sequence const end = enqueuePosition_.load(std::memory_order_relaxed);
+        for (Sequence position =
+               dequeuePosition_.load(std::memory_order_relaxed);
+             position != end;
+             ++position)
+        {
+            Element(slots_[position & mask_])->~T();
+        }
+    }
+
+    /**
+     * @brief Returns the maximum number of elements.
+     */
+    size_type Capacity() const noexcept { return mask_ + 1; }
+
+    /**
+     * @brief Append a copy of an element if a slot is free.
+     *
+     * @return std::optional<ErrorCode> empty on success;
+     * CoreErrc::kQueueFull if the queue is full.
+     */
+    std::optional<ErrorCode> TryPush(T const& value)
+    {
+        return TryPush(T(value));
+    }
+
+    /**
+     * @brief Append an element if a slot is free.
+     *
+     * @return std::optional<ErrorCode> empty on success;
+     * CoreErrc::kQueueFull if the queue is full, value is unchanged then.
+     */
+    std::optional<ErrorCode> TryPush(T&& value) noexcept
+    {
+        Sequence    position;
+        Slot* const slot = Acquire<false>(enqueuePosition_, 0, position);
+        if (slot == nullptr)
+        {
+            return MakeErrorCode(CoreErrc::kQueueFull, 0);
+        }
+        new (slot->storage) T(std::move(value));
+        Release(*slot, position + 1);
+        return std::nullopt;
+    }
+
+    /**
+     * @brief Append an element, waiting for a free slot if the queue is full.
+     */
+    void Push(T value) noexcept
+    {
+        Sequence    position;
+        Slot* const slot = Acquire<true>(enqueuePosition_, 0, position);
+        new (slot->storage) T(std::move(value));
+        Release(*slot, position + 1);
+    }
+
+    /**
+     * @brief Remove the oldest element if there is one.
+     *
+     * @param value receives the element.
+     * @return std::optional<ErrorCode> empty on success;
+     * CoreErrc::kQueueEmpty if the queue is empty, value is unchanged then.
+     */
+    std::optional<ErrorCode> TryPop(T& value)
+    {
+        Sequence    position;
+        Slot* const slot = Acquire<false>(dequeuePosition_, 1, position);
+        if (slot == nullptr)
+        {
+            return MakeErrorCode(CoreErrc::kQueueEmpty, 0);
+        }
+        value = Take(*slot, position);
+        return std::nullopt;
+    }
+
+    /**
+     * @brief Remove the oldest element, waiting for one if the queue is
+     * empty.
+     */
+    T Pop() noexcept
+    {
+        Sequence    position;
+        Slot* const slot = Acquire<true>(dequeuePosition_, 1, position);
+        return Take(*slot, position);
+    }
+
+    /**
+     * @brief Returns the number of elements; a snapshot while other threads
+     * are active.
+     */
+    size_type Size() const noexcept
+    {
+        Sequence const dequeued =
+          dequeuePosition_.load(std::memory_order_acquire);
+        Sequence const enqueued =
+          enqueuePosition_.load(std::memory_order_acquire);
+        return std::min<size_type>(enqueued - dequeued, Capacity());
+    }
+
+    /**
+     * @brief Checks whether the queue is empty; a snapshot while other
+     * threads are active.
+     */
+    bool Empty() const noexcept { return Size() == 0; }
+
+ private:
+    /**
+     * Positions and sequence numbers wrap around; they are compared by their
+     * signed difference. 32 bits, so that std::atomic::wait maps directly to
+     * a futex.
+     */
+    using Sequence = std::uint32_t;
+
+    /**
+     * A slot is free for the producer at position p if its sequence is p,
+     * filled for the consumer at position p if its sequence is p + 1, and
+     * free again for the producer at p + Capacity() once consumed.
+     */
+    struct alignas(internal::kCacheLineSize) Slot
+    {
+        std::atomic<Sequence> sequence;
+        alignas(T) unsigned char storage[sizeof(T)];
+    };
+
+    /**
+     * Claim the slot at the current position, whose sequence shall be the
+     * position plus offset; wait for it or return nullptr if it is not
+     * ready.
+     */
+    template<bool kWait> Slot* Acquire(std::atomic<Sequence>& current,
+                                       Sequence               offset,
+                                       Sequence&              position) noexcept
+    {
+        position = current.load(std::memory_order_relaxed);
+        for (;;)
+        {
+            Slot&          slot = slots_[position & mask_];
+            Sequence const sequence =
+              slot.sequence.load(std::memory_order_acquire);
+            auto const difference =
+              static_cast<std::int32_t>(sequence - (position + offset));
+            if (difference == 0)
+            {
+                if (current.compare_exchange_weak(
+                      position, position + 1, std::memory_order_relaxed))
+                {
+                    return &slot;
+                }
+            }
+            else if (difference < 0)
+            {
+                // full for producers, empty for consumers
+                if constexpr (! kWait)
+                {
+                    return nullptr;
+                }
+                else
+                {
+                    slot.sequence.wait(sequence, std::memory_order_acquire);
+                    position = current.load(std::memory_order_relaxed);
+                }
+            }
+            else
+            {
+                // another thread claimed this position
+                position = current.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    static T* Element(Slot& slot) noexcept
+    {
+        return std::launder(reinterpret_cast<T*>(slot.storage));
+    }
+
+    void Release(Slot& slot, Sequence sequence) noexcept
+    {
+        slot.sequence.store(sequence, std::memory_order_release);
+        slot.sequence.notify_all();
+    }
+
+    T Take(Slot& slot, Sequence position) noexcept
+    {
+        T* const element = Element(slot);
+        T        value(std::move(*element));
+        element->~T();
+        Release(slot, position + static_cast<Sequence>(Capacity()));
+        return value;
+    }
+
+    size_type const               mask_;
+    std::unique_ptr<Slot[]> const slots_;
+    alignas(internal::kCacheLineSize)
+      std::atomic<Sequence> enqueuePosition_{0};
+    alignas(internal::kCacheLineSize)
+      std::atomic<Sequence> dequeuePosition_{0};
+};
+
+}  // namespace ara::core
+
+#endif  // ARA_CORE_MPMCQUEUE_H_
@@ -0,0 +1,263 @@
+/**
+ * Copyright (c) 2020
+ * umlaut Software Development and contributors
+ *
+ * SPDX-License-Identifier: MIT
+ */
+#ifndef ARA_CORE_OFFSETPTR_H_
+#define ARA_CORE_OFFSETPTR_H_
+
+#include <compare>
+#include <cstddef>  // std::ptrdiff_t, std::nullptr_t
+#include <cstdint>  // std::uintptr_t
+#include <iterator>
+#include <type_traits>
+
+namespace ara::core {
+
+/**
+ * @brief Pointer which stores the distance from its own address to the
+ * pointee.
+ *
+ * An OffsetPtr and its pointee which are both placed in one memory region
+ * stay valid when the region is mapped at another address, e.g. by another
+ * process, so it can be used as the pointer type of allocators of shared
+ * memory (a "fancy pointer"). It meets the requirements of
+ * std::pointer_traits, NullablePointer and of a random access iterator, so
+ * AllocatorTraits and containers built on it accept it.
+ *
+ * Copying an OffsetPtr copies the address it points to, not the offset.
+ * Following the convention of other offset pointer implementations, an
+ * offset of 1 encodes the null pointer, so an OffsetPtr cannot point to the
+ * byte after its first one.
+ *
+ * @tparam T the type of the pointee, possibly void or cv-qualified.
+ */
+template<typename T> class OffsetPtr final
+{
+ public:
+    using element_type      = T;
+    using value_type        = std::remove_cv_t<T>;
+    using difference_type   = std::ptrdiff_t;
+    using pointer           = T*;
+    using reference         = std::add_lvalue_reference_t<T>;
+    using iterator_category = std::random_access_iterator_tag;
+    using iterator_concept  = std::contiguous_iterator_tag;
+
+    template<typename U> using rebind = OffsetPtr<U>;
+
+    /**
+     * @brief Construct a null pointer.
+     */
+    OffsetPtr() noexcept = default;
+
+    /**
+     * @brief Construct a null pointer.
+     */
+    OffsetPtr(std::nullptr_t) noexcept {}
+
+    /**
+     * @brief Construct a pointer to the object at address.
+     */
+    OffsetPtr(T* address) noexcept { Set(address); }
+
+    /**
+     * @brief Construct a pointer to the pointee of other.
+     */
+    OffsetPtr(OffsetPtr const& other) noexcept { Set(other.get()); }
+
+    /**
+     * @brief Construct a pointer to the pointee of other, implicitly
+     * converted.
+     */
+    template<typename U>
+    requires std::is_convertible_v<U*, T*>
+    OffsetPtr(OffsetPtr<U> const& other) noexcept
+    {
+        Set(other.get());
+    }
+
+    /**
+     * @brief Construct a pointer to the pointee of other, converted by
+     * static_cast; e.g. from OffsetPtr<void>.
+     */
+    template<typename U>
+    requires(! std::is_convertible_v<U*, T*>)
+    && requires(U* u) { static_cast<T*>(u); }
+    explicit OffsetPtr(OffsetPtr<U> const& other) noexcept
+    {
+        Set(static_cast<T*>(other.get()));
+    }
+
+    /**
+     * @brief Point to the pointee of other.
+     */
+    OffsetPtr& operator=(OffsetPtr const& other) noexcept
+    {
+        Set(other.get());
+        return *this;
+    }
+
+    /**
+     * @brief Point to the object at address.
+     */
+    OffsetPtr& operator=(T* address) noexcept
+    {
+        Set(address);
+        return *this;
+    }
+
+    /**
+     * @brief Returns a pointer to an object, for std::pointer_traits.
+     */
+    template<typename U = T>
+    requires(! std::is_void_v<U>)
+    static OffsetPtr pointer_to(U& r) noexcept
+    {
+        return OffsetPtr{&r};
+    }
+
+    /**
+     * @brief Returns the address of the pointee, nullptr if null.
+     */
+    T* get() const noexcept
+    {
+        if (offset_ == kNull)
+        {
+            return nullptr;
+        }
+        return Pointee();
+    }
+
+    /**
+     * @brief Checks whether the pointer is not null.
+     */
+    explicit operator bool() const noexcept { return offset_ != kNull; }
+
+    /**
+     * @brief Access the pointee; the pointer shall not be null.
+     */
+    reference operator*() const noexcept requires(! std::is_void_v<T>)
+    {
+        return *Pointee();
+    }
+
+    /**
+     * @brief Access a member of the pointee; the pointer shall not be null.
+     *
+     * Unlike get(), this does not check for null, so std::to_address(), which
+     * containers use to construct elements, does not have a null branch. A
+     * null OffsetPtr yields an invalid address instead of nullptr.
+     */
+    T* operator->() const noexcept { return Pointee(); }
+
+    /**
+     * @brief Access the i-th object of the array starting at the pointee;
+     * the pointer shall not be null.
+     */
+    reference operator[](difference_type i) const noexcept
+    requires(! std::is_void_v<T>)
+    {
+        return Pointee()[i];
+    }
+
+    /**
+     * @brief Move within an array, as T* does; the pointer shall not be null.
+     */
+    OffsetPtr& operator+=(difference_type n) noexcept
+    {
+        offset_ += n * static_cast<difference_type>(sizeof(T));
+        return *this;
+    }
+
+    OffsetPtr& operator-=(difference_type n) noexcept
+    {
+        offset_ -= n * static_cast<difference_type>(sizeof(T));
+        return *this;
+    }
+
+    OffsetPtr& operator++() noexcept { return *this += 1; }
+    OffsetPtr& operator--() noexcept { return *this -= 1; }
+
+    OffsetPtr operator++(int) noexcept
+    {
+        OffsetPtr const previous{*this};
+        ++*this;
+        return previous;
+    }
+
+    OffsetPtr operator--(int) noexcept
+    {
+        OffsetPtr const previous{*this};
+        --*this;
+        return previous;
+    }
+
+    friend OffsetPtr operator+(OffsetPtr p, difference_type n) noexcept
+    {
+        return p += n;
+    }
+
+    friend OffsetPtr operator+(difference_type n, OffsetPtr p) noexcept
+    {
+        return p += n;
+    }
+
+    friend OffsetPtr operator-(OffsetPtr p, difference_type n) noexcept
+    {
+        return p -= n;
+    }
+
+    friend difference_type operator-(OffsetPtr const& a,
+                                     OffsetPtr const& b) noexcept
+    {
+        return a.get() - b.get();
+    }
+
+    friend bool operator==(OffsetPtr const& a, OffsetPtr const& b) noexcept
+    {
+        return a.get() == b.get();
+    }
+
+    friend std::strong_ordering operator<=>(OffsetPtr const& a,
+                                            OffsetPtr const& b) noexcept
+    {
+        return std::compare_three_way{}(a.get(), b.get());
+    }
+
+    friend bool operator==(OffsetPtr const& p, std::nullptr_t) noexcept
+    {
+        return ! p;
+    }
+
+ private:
+    static constexpr difference_type kNull = 1;
+
+    std::uintptr_t Address() const noexcept
+    {
+        return reinterpret_cast<std::uintptr_t>(this);
+    }
+
+    /**
+     * Address of the pointee, not checked for null.
+     */
+    T* Pointee() const noexcept
+    {
+        return reinterpret_cast<T*>(Address()
+                                    + static_cast<std::uintptr_t>(offset_));
+    }
+
+    void Set(T const volatile* address) noexcept
+    {
+        offset_ = address == nullptr
+                    ? kNull
+                    : static_cast<difference_type>(
+                      reinterpret_cast<std::uintptr_t>(address) - Address());
+    }
+
+    difference_type offset_{kNull};
+};
+
+}  // namespace ara::core
+
+#endif  // ARA_CORE_OFFSETPTR_H_
@@ -0,0 +1,728 @@
+/**
+ * Copyright (c) 2020
+ * umlaut Software Development and contributors
+ *
+ * SPDX-License-Identifier: MIT
+ */
+#ifndef ARA_CORE_SERIALIZATION_H_
+#define ARA_CORE_SERIALIZATION_H_
+
+#include <algorithm>  // std::all_of, std::min
+#include <cstddef>    // std::size_t
+#include <cstdint>
+#include <cstring>    // std::memcpy
+#include <limits>
+#include <optional>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include "ara/core/array.h"
+#include "ara/core/core_error_domain.h"
+#include "ara/core/error_code.h"
+#include "ara/core/error_code_wire.h"
+#include "ara/core/map.h"
+#include "ara/core/span.h"
+#include "ara/core/string_view.h"
+#include "ara/core/utility.h"
+#include "ara/core/vector.h"
+
+namespace ara::core {
+
+/**
+ * @brief Member list of a user-defined type, which makes the type
+ * serializable.
+ *
+ * Specialize it with a tuple of pointers to the data members, in the order
+ * they shall be serialized:
+ *
+ * @code
+ * template<> struct SerializationMembers<Point>
+ * {
+ *     static constexpr std::tuple members{&Point::x, &Point::y};
+ * };
+ * @endcode
+ */
+template<typename T> struct SerializationMembers
+{};
+
+/**
+ * @brief Marks a trivially copyable type as serializable by copying its object
+ * representation, including any padding, with a single memcpy.
+ *
+ * Arithmetic types, enumerations with a fixed underlying type, Byte and Arrays
+ * of such types are bitwise serializable already. Types holding pointers
+ * shall not be marked, nor shall types with members that not every object
+ * representation is a valid value of, such as bool, if they are read from an
+ * untrusted source.
+ */
+template<typename T> struct IsBitwiseSerializable : std::false_type
+{};
+
+/**
+ * @brief Type of the element count written in front of sequences and maps.
+ */
+using SerializedLengthType = std::uint32_t;
+
+namespace internal {
+
+/**
+ * Offset of a sink which failed to write a sequence or map as its element
+ * count exceeds SerializedLengthType; it is beyond any buffer size and stays
+ * there.
+ */
+constexpr std::size_t kInvalidOffset = std::numeric_limits<std::size_t>::max();
+
+/**
+ * Advance an offset, saturating at kInvalidOffset.
+ */
+constexpr std::size_t Advance(std::size_t offset, std::size_t size) noexcept
+{
+    return size > kInvalidOffset - offset ? kInvalidOffset : offset + size;
+}
+
+template<typename T> concept HasSerializationMembers =
+  requires { SerializationMembers<T>::members; };
+
+template<typename T> concept TupleLike =
+  requires { std::tuple_size<T>::value; };
+
+/**
+ * Enumerations with a fixed underlying type, whose values are all values of
+ * the underlying type; only those can be list-initialized from an integer.
+ */
+template<typename T> concept FixedEnum =
+  std::is_enum_v<T> && requires { T{std::underlying_type_t<T>{}}; };
+
+template<typename T> constexpr bool kBitwiseSerializable =
+  std::is_arithmetic_v<T> || FixedEnum<T> || std::is_same_v<T, Byte>
+  || IsBitwiseSerializable<T>::value;
+
+template<typename T, std::size_t N>
+constexpr bool kBitwiseSerializable<Array<T, N>> = kBitwiseSerializable<T>;
+
+template<typename T, std::size_t N, std::size_t Alignment>
+constexpr bool kBitwiseSerializable<AlignedArray<T, N, Alignment>> =
+  kBitwiseSerializable<T>;
+
+template<typename T> struct IsArray : std::false_type
+{};
+
+template<typename T, std::size_t N>
+struct IsArray<Array<T, N>> : std::true_type
+{};
+
+template<typename T, std::size_t N, std::size_t Alignment>
+struct IsArray<AlignedArray<T, N, Alignment>> : std::true_type
+{};
+
+template<typename T> struct IsVector : std::false_type
+{};
+
+template<typename T, typename Allocator>
+struct IsVector<Vector<T, Allocator>> : std::true_type
+{};
+
+template<typename T> struct IsMap : std::false_type
+{};
+
+template<typename K, typename V, typename C, typename Allocator>
+struct IsMap<Map<K, V, C, Allocator>> : std::true_type
+{};
+
+template<typename T> struct IsView : std::false_type
+{};
+
+template<typename T> struct IsView<Span<T const>> : std::true_type
+{};
+
+template<> struct IsView<StringView> : std::true_type
+{};
+
+/**
+ * Check that the bytes of count objects of a bitwise serializable type are
+ * valid object representations: bool only takes the bytes 0 and 1.
+ */
+template<typename T>
+bool HasValidObjectBytes(Byte const* bytes, std::size_t count) noexcept
+{
+    if constexpr (std::is_same_v<T, bool>)
+    {
+        return std::all_of(bytes, bytes + count, [](Byte byte) {
+            return to_integer<std::uint8_t>(byte) <= 1;
+        });
+    }
+    else if constexpr (IsArray<T>::value)
+    {
+        using Element = typename T::value_type;
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            if (! HasValidObjectBytes<Element>(bytes + i * sizeof(T),
+                                               std::tuple_size_v<T>))
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+    else
+    {
+        return true;
+    }
+}
+
+/**
+ * View the object representation of count objects as bytes.
+ */
+template<typename T>
+Span<Byte const> ObjectBytes(T const* data, std::size_t count = 1) noexcept
+{
+    return {reinterpret_cast<Byte const*>(data), count * sizeof(T)};
+}
+
+/**
+ * Write the element count of a sequence or map; a count exceeding
+ * SerializedLengthType invalidates the sink.
+ */
+template<typename Sink>
+bool WriteLength(Sink& sink, std::size_t size) noexcept
+{
+    if (size > std::numeric_limits<SerializedLengthType>::max())
+    {
+        sink.Invalidate();
+        return false;
+    }
+    auto const length = static_cast<SerializedLengthType>(size);
+    sink.WriteBytes(ObjectBytes(&length));
+    return true;
+}
+
+/**
+ * Write a sequence: its length, padding up to the alignment of its elements if
+ * they are copied bitwise, and the elements.
+ */
+template<typename Sink, typename T>
+void WriteSequence(Sink& sink, T const* data, std::size_t size) noexcept;
+
+/**
+ * Write a value to a sink, which provides WriteBytes(bytes), Pad(alignment)
+ * and Invalidate(); the layout of all types is defined here.
+ */
+template<typename Sink, typename T>
+void WriteValue(Sink& sink, T const& value) noexcept
+{
+    if constexpr (HasSerializationMembers<T>)
+    {
+        std::apply(
+          [&](auto... members) { (WriteValue(sink, value.*members), ...); },
+          SerializationMembers<T>::members);
+    }
+    else if constexpr (kBitwiseSerializable<T>)
+    {
+        static_assert(std::is_trivially_copyable_v<T>,
+                      "Bitwise serializable type is not trivially copyable");
+        sink.WriteBytes(ObjectBytes(&value));
+    }
+    else if constexpr (std::is_same_v<T, ErrorCode>)
+    {
+        Byte wire[kErrorCodeWireSize];
+        EncodeErrorCode(value, wire);
+        sink.WriteBytes(wire);
+    }
+    else if constexpr (IsVector<T>::value)
+    {
+        WriteSequence(sink, value.data(), value.size());
+    }
+    else if constexpr (IsView<T>::value)
+    {
+        WriteSequence(sink, value.data(), value.size());
+    }
+    else if constexpr (IsMap<T>::value)
+    {
+        if (! WriteLength(sink, value.size()))
+        {
+            return;
+        }
+        for (auto const& entry : value)
+        {
+            WriteValue(sink, entry.first);
+            WriteValue(sink, entry.second);
+        }
+    }
+    else if constexpr (TupleLike<T>)
+    {
+        [&]<std::size_t... I>(std::index_sequence<I...>) {
+            using std::get;
+            (WriteValue(sink, get<I>(value)), ...);
+        }(std::make_index_sequence<std::tuple_size_v<T>>{});
+    }
+    else
+    {
+        static_assert(HasSerializationMembers<T>,
+                      "Type is not serializable; specialize "
+                      "SerializationMembers or IsBitwiseSerializable");
+    }
+}
+
+template<typename Sink, typename T>
+void WriteSequence(Sink& sink, T const* data, std::size_t size) noexcept
+{
+    if (! WriteLength(sink, size))
+    {
+        return;
+    }
+    if constexpr (kBitwiseSerializable<T>)
+    {
+        sink.Pad(alignof(T));
+        sink.WriteBytes(ObjectBytes(data, size));
+    }
+    else
+    {
+        for (std::size_t i = 0; i < size; ++i) { WriteValue(sink, data[i]); }
+    }
+}
+
+/**
+ * Sink which only counts the bytes, to precompute the size of a value.
+ */
+class SizeCounter final
+{
+ public:
+    void WriteBytes(Span<Byte const> bytes) noexcept
+    {
+        offset = Advance(offset, bytes.size());
+    }
+
+    void Pad(std::size_t alignment) noexcept
+    {
+        if (offset != kInvalidOffset)
+        {
+            offset = (offset + alignment - 1) / alignment * alignment;
+        }
+    }
+
+    void Invalidate() noexcept { offset = kInvalidOffset; }
+
+    std::size_t Offset() const noexcept { return offset; }
+
+ private:
+    std::size_t offset = 0;
+};
+
+}  // namespace internal
+
+/**
+ * @brief Computes the number of bytes Serialize() writes for a value.
+ *
+ * The size of a value without sequences or maps is a constant the compiler
+ * folds; for sequences of bitwise serializable elements it is a
+ * multiplication. It is the maximum of std::size_t if a sequence or map has
+ * more elements than SerializedLengthType can count.
+ *
+ * @param value the value.
+ */
+template<typename T> std::size_t SerializedSize(T const& value) noexcept
+{
+    internal::SizeCounter counter;
+    internal::WriteValue(counter, value);
+    return counter.Offset();
+}
+
+/**
+ * @brief Writes values consecutively into a caller-provided buffer.
+ *
+ * The format is meant for the exchange between processes of the same machine,
+ * e.g. through shared memory: bitwise serializable values are copied in their
+ * native representation, runs of them (Array, Vector, Span) with one memcpy.
+ * Sequences and maps are preceded by their element count as
+ * SerializedLengthType. A run of bitwise serializable elements starts at an
+ * offset that is a multiple of their alignment, so that a Deserializer can
+ * return a view of it if the buffer is suitably aligned. ErrorCodes are
+ * written in the wire format of EncodeErrorCode().
+ *
+ * Bytes which do not fit into the buffer are dropped, but still counted by
+ * Offset(), so an Offset() beyond the buffer size reports the overflow. Use
+ * SerializedSize() to size the buffer. A sequence or map with more elements
+ * than SerializedLengthType can count is not written; Offset() then stays at
+ * the maximum of std::size_t, which reports the failure the same way.
+ */
+class Serializer final
+{
+ public:
+    /**
+     * @brief Construct a serializer writing from the beginning of a buffer.
+     *
+     * @param buffer the buffer, which shall outlive the serializer.
+     */
+    explicit Serializer(Span<Byte> buffer) noexcept : buffer{buffer} {}
+
+    /**
+     * @brief Appends a value.
+     *
+     * @param value the value; the buffer shall hold at least
+     * SerializedSize(value) more bytes, plus up to alignment - 1 bytes of
+     * padding if the offset is not aligned.
+     * @return Serializer& this object.
+     */
+    template<typename T> Serializer& Write(T const& value) noexcept
+    {
+        internal::WriteValue(*this, value);
+        return *this;
+    }
+
+    /**
+     * @brief Appends raw bytes.
+     *
+     * @param bytes the bytes.
+     */
+    void WriteBytes(Span<Byte const> bytes) noexcept
+    {
+        if (! bytes.empty() && offset <= buffer.size()
+            && bytes.size() <= buffer.size() - offset)
+        {
+            std::memcpy(buffer.data() + offset, bytes.data(), bytes.size());
+        }
+        offset = internal::Advance(offset, bytes.size());
+    }
+
+    /**
+     * @brief Appends zero bytes up to the next multiple of alignment.
+     */
+    void Pad(std::size_t alignment) noexcept
+    {
+        for (; offset % alignment != 0 && offset != internal::kInvalidOffset;
+             ++offset)
+        {
+            if (offset < buffer.size())
+            {
+                buffer[offset] = Byte{0};
+            }
+        }
+    }
+
+    /**
+     * @brief Marks the serialization as failed: Offset() stays at the maximum
+     * of std::size_t from now on.
+     */
+    void Invalidate() noexcept { offset = internal::kInvalidOffset; }
+
+    /**
+     * @brief Returns the number of bytes written so far, including those
+     * dropped as they did not fit into the buffer.
+     */
+    std::size_t Offset() const noexcept { return offset; }
+
+    /**
+     * @brief Returns the bytes written so far.
+     */
+    Span<Byte> Written() const noexcept
+    {
+        return buffer.first(std::min(offset, buffer.size()));
+    }
+
+ private:
+    Span<Byte>  buffer;
+    std::size_t offset = 0;
+};
+
+/**
+ * @brief Reads values written by a Serializer.
+ *
+ * The input is checked, so it may come from an untrusted source: bytes other
+ * than 0 and 1 are rejected as bool, enumerations take any value of their
+ * underlying type, which the caller checks against its enumerators if needed.
+ * Sequences of bitwise serializable elements are copied with one memcpy, or
+ * returned without copying if read into a Span<T const> or a StringView,
+ * which then refer to the buffer.
+ */
+class Deserializer final
+{
+ public:
+    /**
+     * @brief Construct a deserializer reading from the beginning of a buffer.
+     *
+     * @param buffer the buffer, which shall outlive the deserializer and any
+     * view read from it.
+     */
+    explicit Deserializer(Span<Byte const> buffer) noexcept : buffer{buffer} {}
+
+    /**
+     * @brief Reads the next value.
+     *
+     * Vectors and Maps are replaced by the elements read; their elements shall
+     * be default constructible or ErrorCodes.
+     *
+     * @param value receives the value.
+     * @return std::optional<ErrorCode> empty on success;
+     * CoreErrc::kInvalidArgument with the offset of the offending data as
+     * support data if the buffer is truncated, holds an invalid bool, a view
+     * would be misaligned, or the domain of an ErrorCode is not registered.
+     */
+    template<typename T> std::optional<ErrorCode> Read(T& value)
+    {
+        std::size_t const start = offset;
+        if (! ReadValue(value))
+        {
+            std::size_t const failed = offset;
+            offset                   = start;
+            return MakeErrorCode(
+              CoreErrc::kInvalidArgument,
+              static_cast<ErrorDomain::SupportDataType>(failed));
+        }
+        return std::nullopt;
+    }
+
+    /**
+     * @brief Returns the number of bytes read so far.
+     */
+    std::size_t Offset() const noexcept { return offset; }
+
+    /**
+     * @brief Returns the bytes not read yet.
+     */
+    Span<Byte const> Remaining() const noexcept
+    {
+        return buffer.subspan(offset);
+    }
+
+ private:
+    bool ReadBytes(void* data, std::size_t size) noexcept
+    {
+        if (size > buffer.size() - offset)
+        {
+            return false;
+        }
+        if (size > 0)
+        {
+            std::memcpy(data, buffer.data() + offset, size);
+            offset += size;
+        }
+        return true;
+    }
+
+    bool SkipPadding(std::size_t alignment) noexcept
+    {
+        std::size_t const aligned =
+          (offset + alignment - 1) / alignment * alignment;
+        if (aligned > buffer.size())
+        {
+            return false;
+        }
+        offset = aligned;
+        return true;
+    }
+
+    /**
+     * Read the length of a sequence of elements of at least minSize bytes,
+     * rejecting lengths the rest of the buffer cannot hold.
+     */
+    bool ReadLength(std::size_t& length, std::size_t minSize) noexcept
+    {
+        SerializedLengthType value;
+        if (! ReadBytes(&value, sizeof(value)))
+        {
+            return false;
+        }
+        length = value;
+        return minSize == 0 || length <= (buffer.size() - offset) / minSize;
+    }
+
+    /**
+     * Read a run of bitwise serializable elements, returning its address in
+     * the buffer.
+     */
+    template<typename T>
+    bool ReadRun(T const*& data, std::size_t& length) noexcept
+    {
+        if (! ReadLength(length, sizeof(T)) || ! SkipPadding(alignof(T))
+            || length * sizeof(T) > buffer.size() - offset
+            || ! internal::HasValidObjectBytes<T>(buffer.data() + offset,
+                                                  length))
+        {
+            return false;
+        }
+        data = reinterpret_cast<T const*>(buffer.data() + offset);
+        return true;
+    }
+
+    /**
+     * Read a value into a new object; ErrorCodes, which have no default
+     * constructor, are constructed from the decoded value.
+     */
+    template<typename T> std::optional<T> ReadNew()
+    {
+        if constexpr (std::is_same_v<T, ErrorCode>)
+        {
+            if (kErrorCodeWireSize > buffer.size() - offset)
+            {
+                return std::nullopt;
+            }
+            std::optional<ErrorCode> code = DecodeErrorCode(
+              buffer.subspan(offset).template first<kErrorCodeWireSize>());
+            if (code)
+            {
+                offset += kErrorCodeWireSize;
+            }
+            return code;
+        }
+        else
+        {
+            std::optional<T> value{std::in_place};
+            if (! ReadValue(*value))
+            {
+                return std::nullopt;
+            }
+            return value;
+        }
+    }
+
+    template<typename T> bool ReadValue(T& value)
+    {
+        if constexpr (internal::HasSerializationMembers<T>)
+        {
+            return std::apply(
+              [&](auto... members) {
+                  return (ReadValue(value.*members) && ...);
+              },
+              SerializationMembers<T>::members);
+        }
+        else if constexpr (internal::kBitwiseSerializable<T>)
+        {
+            return sizeof(T) <= buffer.size() - offset
+                   && internal::HasValidObjectBytes<T>(buffer.data() + offset,
+                                                       1)
+                   && ReadBytes(&value, sizeof(T));
+        }
+        else if constexpr (std::is_same_v<T, ErrorCode>)
+        {
+            std::optional<ErrorCode> const code = ReadNew<ErrorCode>();
+            if (code)
+            {
+                value = *code;
+            }
+            return code.has_value();
+        }
+        else if constexpr (internal::IsVector<T>::value)
+        {
+            using Element = typename T::value_type;
+            if constexpr (internal::kBitwiseSerializable<Element>)
+            {
+                Element const* data;
+                std::size_t    length;
+                if (! ReadRun(data, length))
+                {
+                    return false;
+                }
+                value.resize(length);
+                return ReadBytes(value.data(), length * sizeof(Element));
+            }
+            else
+            {
+                std::size_t length;
+                if (! ReadLength(length, 1))
+                {
+                    return false;
+                }
+                value.clear();
+                for (std::size_t i = 0; i < length; ++i)
+                {
+                    std::optional<Element> element = ReadNew<Element>();
+                    if (! element)
+                    {
+                        return false;
+                    }
+                    value.push_back(std::move(*element));
+                }
+                return true;
+            }
+        }
+        else if constexpr (internal::IsView<T>::value)
+        {
+            using Element = std::remove_const_t<typename T::value_type>;
+            static_assert(internal::kBitwiseSerializable<Element>,
+                          "Only runs of bitwise serializable elements can be "
+                          "read as views");
+            Element const* data;
+            std::size_t    length;
+            if (! ReadRun(data, length)
+                || reinterpret_cast<std::uintptr_t>(data) % alignof(Element)
+                     != 0)
+            {
+                return false;
+            }
+            value = T{data, length};
+            offset += length * sizeof(Element);
+            return true;
+        }
+        else if constexpr (internal::IsMap<T>::value)
+        {
+            std::size_t length;
+            if (! ReadLength(length, 1))
+            {
+                return false;
+            }
+            value.clear();
+            for (std::size_t i = 0; i < length; ++i)
+            {
+                auto key    = ReadNew<typename T::key_type>();
+                auto mapped = key ? ReadNew<typename T::mapped_type>()
+                                  : std::nullopt;
+                if (! mapped)
+                {
+                    return false;
+                }
+                value.emplace(std::move(*key), std::move(*mapped));
+            }
+            return true;
+        }
+        else if constexpr (internal::TupleLike<T>)
+        {
+            return [&]<std::size_t... I>(std::index_sequence<I...>) {
+                using std::get;
+                return (ReadValue(get<I>(value)) && ...);
+            }(std::make_index_sequence<std::tuple_size_v<T>>{});
+        }
+        else
+        {
+            static_assert(internal::HasSerializationMembers<T>,
+                          "Type is not serializable; specialize "
+                          "SerializationMembers or IsBitwiseSerializable");
+            return false;
+        }
+    }
+
+    Span<Byte const> buffer;
+    std::size_t      offset = 0;
+};
+
+/**
+ * @brief Serializes a value into a caller-provided buffer.
+ *
+ * @param value the value.
+ * @param buffer receives the value; shall hold at least SerializedSize(value)
+ * bytes, otherwise the bytes which do not fit are dropped.
+ * @return std::size_t SerializedSize(value); a result beyond the buffer size
+ * reports that the value was not written completely.
+ */
+template<typename T> std::size_t
+Serialize(T const& value, Span<Byte> buffer) noexcept
+{
+    return Serializer{buffer}.Write(value).Offset();
+}
+
+/**
+ * @brief Deserializes a value from a buffer.
+ *
+ * @param buffer the serialized value; trailing bytes are ignored.
+ * @param value receives the value.
+ * @return std::optional<ErrorCode> empty on success, see Deserializer::Read.
+ */
+template<typename T> std::optional<ErrorCode>
+Deserialize(Span<Byte const> buffer, T& value)
+{
+    return Deserializer{buffer}.Read(value);
+}
+
+}  // namespace ara::core
+
+#endif  // ARA_CORE_SERIALIZATION_H_
@@ -0,0 +1,360 @@
+/**
+ * Copyright (c) 2020
+ * umlaut Software Development and contributors
+ *
+ * SPDX-License-Identifier: MIT
+ */
+#ifndef ARA_CORE_SHAREDMEMORY_H_
+#define ARA_CORE_SHAREDMEMORY_H_
+
+#include <cstddef>  // std::size_t, std::ptrdiff_t
+#include <memory>   // std::to_address
+#include <new>      // std::bad_alloc
+#include <optional>
+#include <type_traits>
+#include <utility>  // std::forward
+
+#include "ara/core/offset_ptr.h"
+#include "ara/core/string_view.h"
+
+namespace ara::core {
+
+namespace internal {
+
+/**
+ * Management data at the start of every segment; it is shared by all
+ * processes which map the segment, so it holds offsets only.
+ */
+struct SegmentHeader;
+
+/**
+ * Allocate from the free space of a segment.
+ *
+ * @return void* aligned to alignof(std::max_align_t), nullptr if there is no
+ * free block of size bytes.
+ */
+void* SegmentAllocate(SegmentHeader& header, std::size_t size) noexcept;
+
+/**
+ * Return memory obtained by SegmentAllocate() to the free space.
+ */
+void SegmentDeallocate(SegmentHeader& header, void* address) noexcept;
+
+/**
+ * Raw pointer, as the pointer template of SharedMemoryAllocator.
+ */
+template<typename T> using RawPtr = T*;
+
+}  // namespace internal
+
+/**
+ * @brief A region of shared memory, mapped into the address space of this
+ * process, with an allocator for the objects placed in it.
+ *
+ * A segment is either a named POSIX shared memory object (Create() and
+ * Open()), or an anonymous memfd (CreateAnonymous()) whose file descriptor
+ * is passed to other processes, e.g. over a Unix domain socket. Allocation
+ * is safe from any process which has mapped the segment; it is serialized
+ * by a robust process-shared mutex in the segment. If a process dies while
+ * allocating or releasing, the next one to lock the mutex recovers the free
+ * space; the blocks being moved by the dead process may be lost.
+ *
+ * Objects in a segment shall refer to each other via OffsetPtr, so that
+ * they stay valid wherever the segment is mapped; containers do so when
+ * they use SharedMemoryAllocator. Node based containers such as Map do not
+ * use the pointer type of their allocator for their links, see
+ * FixedSharedMemoryAllocator.
+ */
+class SharedMemorySegment final
+{
+ public:
+    /**
+     * @brief Create a named segment.
+     *
+     * @param name the name of the shared memory object, starting with '/'.
+     * @param size the size of the mapping in bytes, including the management
+     * data.
+     * @param address if not null, the segment is mapped at this address or
+     * not at all.
+     * @return std::optional<SharedMemorySegment> empty if the object exists
+     * already or a system call failed; errno tells why.
+     */
+    static std::optional<SharedMemorySegment>
+    Create(StringView name, std::size_t size, void* address = nullptr);
+
+    /**
+     * @brief Map a named segment created by Create(), maybe by another
+     * process.
+     *
+     * @param name the name passed to Create().
+     * @param address if not null, the segment is mapped at this address or
+     * not at all.
+     * @return std::optional<SharedMemorySegment> empty if the object does not
+     * exist, is not a segment or a system call failed; errno tells why.
+     */
+    static std::optional<SharedMemorySegment>
+    Open(StringView name, void* address = nullptr);
+
+    /**
+     * @brief Remove the name of a named segment; the memory is released when
+     * it is not mapped anymore.
+     *
+     * @return bool false if there was no such object.
+     */
+    static bool Remove(StringView name) noexcept;
+
+    /**
+     * @brief Create an anonymous segment, backed by a memfd on Linux.
+     *
+     * @param size the size of the mapping in bytes, including the management
+     * data.
+     * @return std::optional<SharedMemorySegment> empty if a system call failed;
+     * errno tells why.
+     */
+    static std::optional<SharedMemorySegment> CreateAnonymous(std::size_t size);
+
+    /**
+     * @brief Map a segment via its file descriptor, e.g. as received from the
+     * process which created it anonymously.
+     *
+     * @param fd the file descriptor; it is duplicated.
+     * @param address if not null, the segment is mapped at this address or
+     * not at all.
+     * @return std::optional<SharedMemorySegment> empty if fd is not a segment
+     * or a system call failed; errno tells why.
+     */
+    static std::optional<SharedMemorySegment>
+    FromFileDescriptor(int fd, void* address = nullptr);
+
+    SharedMemorySegment(SharedMemorySegment&& other) noexcept;
+    SharedMemorySegment& operator=(SharedMemorySegment&& other) noexcept;
+
+    /**
+     * @brief Unmap the segment; objects in it are not destroyed.
+     */
+    ~SharedMemorySegment();
+
+    /**
+     * @brief Returns the address of the mapping in this process.
+     */
+    void* Address() const noexcept { return header_; }
+
+    /**
+     * @brief Returns the size of the mapping in bytes.
+     */
+    std::size_t Size() const noexcept { return size_; }
+
+    /**
+     * @brief Returns the file descriptor of the segment, valid as long as
+     * the segment.
+     */
+    int FileDescriptor() const noexcept { return fd_; }
+
+    /**
+     * @brief Returns the number of bytes available for allocation, the
+     * largest possible allocation is smaller if the free space is
+     * fragmented.
+     */
+    std::size_t FreeSize() const noexcept;
+
+    /**
+     * @brief Allocate memory in the segment.
+     *
+     * @return void* aligned to alignof(std::max_align_t), nullptr if there is
+     * not enough free space.
+     */
+    void* Allocate(std::size_t size) noexcept
+    {
+        return internal::SegmentAllocate(*header_, size);
+    }
+
+    /**
+     * @brief Release memory obtained by Allocate().
+     */
+    void Deallocate(void* address) noexcept
+    {
+        internal::SegmentDeallocate(*header_, address);
+    }
+
+    /**
+     * @brief Construct an object in the segment.
+     *
+     * @return T* the object, nullptr if there is not enough free space.
+     */
+    template<typename T, typename... Args> T* Construct(Args&&... args)
+    {
+        static_assert(alignof(T) <= alignof(std::max_align_t),
+                      "over-aligned types are not supported");
+        void* const address = Allocate(sizeof(T));
+        if (address == nullptr)
+        {
+            return nullptr;
+        }
+        return new (address) T(std::forward<Args>(args)...);
+    }
+
+    /**
+     * @brief Destroy an object constructed by Construct().
+     */
+    template<typename T> void Destroy(T* object) noexcept
+    {
+        object->~T();
+        Deallocate(object);
+    }
+
+    /**
+     * @brief Make an object in the segment, e.g. a container, the one which
+     * other processes find via Root().
+     *
+     * @param object in the segment, or nullptr.
+     */
+    void SetRoot(void const* object) noexcept;
+
+    /**
+     * @brief Returns the object set by SetRoot(), maybe by another process.
+     */
+    template<typename T> T* Root() const noexcept
+    {
+        return static_cast<T*>(RootAddress());
+    }
+
+    /**
+     * @brief Returns the management data, for SharedMemoryAllocator.
+     */
+    internal::SegmentHeader& Header() const noexcept { return *header_; }
+
+ private:
+    SharedMemorySegment(internal::SegmentHeader* header,
+                        std::size_t              size,
+                        int                      fd) noexcept;
+
+    static std::optional<SharedMemorySegment>
+    Map(int fd, std::size_t size, void* address, bool initialize);
+
+    void* RootAddress() const noexcept;
+
+    internal::SegmentHeader* header_;
+    std::size_t              size_;
+    int                      fd_;
+};
+
+/**
+ * @brief Allocator of memory in a SharedMemorySegment, whose pointer type is
+ * OffsetPtr by default.
+ *
+ * The allocator refers to the segment via an OffsetPtr too, so a container
+ * placed in the segment together with its allocator can be read and modified
+ * by every process which maps the segment, at any address, e.g.
+ * Vector<int, SharedMemoryAllocator<int>>.
+ *
+ * @tparam T the type of the objects to allocate.
+ * @tparam Pointer the template of the pointer type.
+ */
+template<typename T, template<typename> class Pointer = OffsetPtr>
+class SharedMemoryAllocator
+{
+    static_assert(alignof(T) <= alignof(std::max_align_t),
+                  "over-aligned types are not supported");
+
+ public:
+    using value_type         = T;
+    using pointer            = Pointer<T>;
+    using const_pointer      = Pointer<T const>;
+    using void_pointer       = Pointer<void>;
+    using const_void_pointer = Pointer<void const>;
+    using size_type          = std::size_t;
+    using difference_type    = std::ptrdiff_t;
+
+    using propagate_on_container_copy_assignment = std::true_type;
+    using propagate_on_container_move_assignment = std::true_type;
+    using propagate_on_container_swap            = std::true_type;
+    using is_always_equal                        = std::false_type;
+
+    template<typename U> struct rebind
+    {
+        using other = SharedMemoryAllocator<U, Pointer>;
+    };
+
+    /**
+     * @brief Construct an allocator of memory in segment.
+     */
+    explicit SharedMemoryAllocator(SharedMemorySegment const& segment) noexcept
+        : header_{&segment.Header()}
+    {}
+
+    /**
+     * @brief Construct an allocator of memory in the segment of other.
+     */
+    template<typename U> SharedMemoryAllocator(
+      SharedMemoryAllocator<U, Pointer> const& other) noexcept
+        : header_{other.header_}
+    {}
+
+    SharedMemoryAllocator(SharedMemoryAllocator const& other) noexcept =
+      default;
+    SharedMemoryAllocator&
+    operator=(SharedMemoryAllocator const& other) noexcept = default;
+
+    /**
+     * @brief Allocate memory for count objects.
+     *
+     * @throws std::bad_alloc if there is not enough free space.
+     */
+    pointer allocate(size_type count)
+    {
+        if (count > static_cast<size_type>(-1) / sizeof(T))
+        {
+            throw std::bad_alloc{};
+        }
+        void* const address =
+          internal::SegmentAllocate(*header_, count * sizeof(T));
+        if (address == nullptr)
+        {
+            throw std::bad_alloc{};
+        }
+        return pointer{static_cast<T*>(address)};
+    }
+
+    /**
+     * @brief Release memory obtained by allocate().
+     */
+    void deallocate(pointer p, size_type) noexcept
+    {
+        internal::SegmentDeallocate(
+          *header_, p == nullptr ? nullptr : std::to_address(p));
+    }
+
+    /**
+     * @brief Checks whether two allocators use the same segment.
+     */
+    template<typename U>
+    bool
+    operator==(SharedMemoryAllocator<U, Pointer> const& other) const noexcept
+    {
+        return header_ == other.header_;
+    }
+
+ private:
+    template<typename U, template<typename> class P>
+    friend class SharedMemoryAllocator;
+
+    OffsetPtr<internal::SegmentHeader> header_;
+};
+
+/**
+ * @brief Allocator of memory in a SharedMemorySegment with raw pointers, for
+ * node based containers.
+ *
+ * std::map, on which Map is built, keeps raw pointers between its nodes and
+ * does not accept an allocator whose pointer type is OffsetPtr. A Map in a
+ * segment, e.g. Map<K, V, std::less<K>,
+ * FixedSharedMemoryAllocator<std::pair<K const, V>>>, is thus usable only by
+ * processes which map the segment at the same address, see the address
+ * parameters of SharedMemorySegment.
+ */
+template<typename T>
+using FixedSharedMemoryAllocator = SharedMemoryAllocator<T, internal::RawPtr>;
+
+}  // namespace ara::core
+
+#endif  // ARA_CORE_SHAREDMEMORY_H_
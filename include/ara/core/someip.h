@@ -0,0 +1,607 @@
+/**
+ * Copyright (c) 2020
+ * umlaut Software Development and contributors
+ *
+ * SPDX-License-Identifier: MIT
+ */
+#ifndef ARA_CORE_SOMEIP_H_
+#define ARA_CORE_SOMEIP_H_
+
+#include <bit>      // std::bit_cast, std::endian
+#include <cstddef>  // std::size_t
+#include <cstdint>
+#include <cstring>  // std::memcpy
+#include <limits>
+#include <optional>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include "ara/core/core_error_domain.h"
+#include "ara/core/endian.h"
+#include "ara/core/error_code.h"
+#include "ara/core/serialization.h"
+#include "ara/core/span.h"
+#include "ara/core/utility.h"
+
+namespace ara::core {
+
+/**
+ * @brief Deployment parameters of the SOME/IP serialization.
+ */
+struct SomeIpConfig
+{
+    /**
+     * Size in bytes of the length fields of dynamic length arrays and maps:
+     * 1, 2 or 4.
+     */
+    std::size_t lengthFieldSize = 4;
+    /**
+     * Alignment of the data following a dynamic length array or map, relative
+     * to the start of the payload; padding bytes are inserted after the array
+     * and are not included in its length field.
+     */
+    std::size_t alignment = 1;
+};
+
+namespace internal {
+
+template<typename T> concept SomeIpScalar =
+  std::is_arithmetic_v<T> || std::is_enum_v<T> || std::is_same_v<T, Byte>;
+
+/**
+ * Scalars whose runs are stored unchanged: bytes and single byte integers.
+ * bool is excluded, as a payload byte other than 0 and 1 is no valid bool.
+ */
+template<typename T> concept SomeIpByteScalar =
+  std::is_same_v<T, Byte>
+  || (std::is_integral_v<T> && ! std::is_same_v<T, bool> && sizeof(T) == 1);
+
+template<typename T> struct IsSomeIpArray : std::false_type
+{};
+
+template<typename T, std::size_t N>
+struct IsSomeIpArray<Array<T, N>> : std::true_type
+{};
+
+template<typename T, std::size_t N, std::size_t Alignment>
+struct IsSomeIpArray<AlignedArray<T, N, Alignment>> : std::true_type
+{};
+
+template<std::size_t Size> using SomeIpLengthType = std::conditional_t<
+  Size == 1,
+  std::uint8_t,
+  std::conditional_t<Size == 2, std::uint16_t, std::uint32_t>>;
+
+template<typename T> using SomeIpFloatBits =
+  std::conditional_t<sizeof(T) == 4, std::uint32_t, std::uint64_t>;
+
+constexpr bool IsValid(SomeIpConfig config) noexcept
+{
+    return (config.lengthFieldSize == 1 || config.lengthFieldSize == 2
+            || config.lengthFieldSize == 4)
+           && config.alignment > 0;
+}
+
+inline ErrorCode MakeSomeIpError(std::size_t offset) noexcept
+{
+    return MakeErrorCode(CoreErrc::kInvalidArgument,
+                         static_cast<ErrorDomain::SupportDataType>(offset));
+}
+
+}  // namespace internal
+
+/**
+ * @brief Encodes values into a SOME/IP payload.
+ *
+ * Scalars are written in big endian byte order, bool as one byte, floating
+ * point numbers in IEEE 754 format. Arrays are written as fixed length
+ * arrays, Vectors as dynamic length arrays and Maps as dynamic length arrays
+ * of key/value structs; dynamic length arrays are preceded by their length in
+ * bytes. Tuple-like types and types with SerializationMembers are written as
+ * structs without length field.
+ *
+ * Encoding is a single pass: length fields are reserved and filled in after
+ * their data is written, and runs of integers are stored with one byte swap
+ * loop each.
+ *
+ * @tparam Config deployment parameters.
+ */
+template<SomeIpConfig Config = SomeIpConfig{}> class SomeIpEncoder final
+{
+    static_assert(internal::IsValid(Config), "Invalid SomeIpConfig");
+
+ public:
+    /**
+     * @brief Construct an encoder writing from the beginning of a payload
+     * buffer.
+     *
+     * @param buffer the buffer, which shall outlive the encoder.
+     */
+    explicit SomeIpEncoder(Span<Byte> buffer) noexcept : buffer{buffer} {}
+
+    /**
+     * @brief Appends a value.
+     *
+     * @param value the value.
+     * @return std::optional<ErrorCode> empty on success;
+     * CoreErrc::kInvalidArgument with the offset as support data if the
+     * buffer is too small or a length does not fit into the length field, in
+     * which case nothing is appended.
+     */
+    template<typename T> std::optional<ErrorCode> Encode(T const& value)
+    {
+        std::size_t const start = offset;
+        if (! EncodeValue(value))
+        {
+            std::size_t const failed = offset;
+            offset                   = start;
+            return internal::MakeSomeIpError(failed);
+        }
+        return std::nullopt;
+    }
+
+    /**
+     * @brief Returns the number of bytes written so far.
+     */
+    std::size_t Offset() const noexcept { return offset; }
+
+    /**
+     * @brief Returns the payload written so far.
+     */
+    Span<Byte> Written() const noexcept { return buffer.first(offset); }
+
+ private:
+    using LengthType = internal::SomeIpLengthType<Config.lengthFieldSize>;
+
+    bool Fits(std::size_t size) const noexcept
+    {
+        return size <= buffer.size() - offset;
+    }
+
+    template<typename T> bool EncodeScalar(T value) noexcept
+    {
+        if constexpr (std::is_same_v<T, Byte>)
+        {
+            if (! Fits(1))
+            {
+                return false;
+            }
+            buffer[offset++] = value;
+            return true;
+        }
+        else if constexpr (std::is_same_v<T, bool>)
+        {
+            return EncodeScalar(std::uint8_t{value});
+        }
+        else if constexpr (std::is_enum_v<T>)
+        {
+            return EncodeScalar(static_cast<std::underlying_type_t<T>>(value));
+        }
+        else if constexpr (std::is_floating_point_v<T>)
+        {
+            return EncodeScalar(
+              std::bit_cast<internal::SomeIpFloatBits<T>>(value));
+        }
+        else
+        {
+            if (! Fits(sizeof(T)))
+            {
+                return false;
+            }
+            StoreInteger<std::endian::big>(
+              value, buffer.subspan(offset).template first<sizeof(T)>());
+            offset += sizeof(T);
+            return true;
+        }
+    }
+
+    template<typename T>
+    bool EncodeRun(T const* data, std::size_t size) noexcept
+    {
+        if constexpr (internal::SomeIpByteScalar<T>)
+        {
+            if (! Fits(size))
+            {
+                return false;
+            }
+            if (size > 0)
+            {
+                std::memcpy(
+                  static_cast<void*>(buffer.data() + offset), data, size);
+            }
+            offset += size;
+            return true;
+        }
+        else if constexpr (std::is_integral_v<T> && ! std::is_same_v<T, bool>)
+        {
+            if (size > (buffer.size() - offset) / sizeof(T))
+            {
+                return false;
+            }
+            StoreIntegers<std::endian::big>(Span<T const>{data, size},
+                                            buffer.subspan(offset));
+            offset += size * sizeof(T);
+            return true;
+        }
+        else
+        {
+            for (std::size_t i = 0; i < size; ++i)
+            {
+                if (! EncodeValue(data[i]))
+                {
+                    return false;
+                }
+            }
+            return true;
+        }
+    }
+
+    /**
+     * Write a dynamic length array: reserve its length field, write the
+     * elements with the given function, fill in the length and pad.
+     */
+    template<typename F> bool EncodeDynamic(F&& encodeElements)
+    {
+        if (! Fits(sizeof(LengthType)))
+        {
+            return false;
+        }
+        std::size_t const lengthOffset = offset;
+        offset += sizeof(LengthType);
+        if (! encodeElements())
+        {
+            return false;
+        }
+        std::size_t const length = offset - lengthOffset - sizeof(LengthType);
+        if (length > std::numeric_limits<LengthType>::max())
+        {
+            return false;
+        }
+        StoreInteger<std::endian::big>(
+          static_cast<LengthType>(length),
+          buffer.subspan(lengthOffset).template first<sizeof(LengthType)>());
+        while (offset % Config.alignment != 0)
+        {
+            if (! Fits(1))
+            {
+                return false;
+            }
+            buffer[offset++] = Byte{0};
+        }
+        return true;
+    }
+
+    template<typename T> bool EncodeValue(T const& value)
+    {
+        if constexpr (internal::HasSerializationMembers<T>)
+        {
+            return std::apply(
+              [&](auto... members) {
+                  return (EncodeValue(value.*members) && ...);
+              },
+              SerializationMembers<T>::members);
+        }
+        else if constexpr (internal::SomeIpScalar<T>)
+        {
+            return EncodeScalar(value);
+        }
+        else if constexpr (internal::IsSomeIpArray<T>::value)
+        {
+            return EncodeRun(value.data(), value.size());
+        }
+        else if constexpr (internal::IsVector<T>::value)
+        {
+            return EncodeDynamic(
+              [&] { return EncodeRun(value.data(), value.size()); });
+        }
+        else if constexpr (internal::IsMap<T>::value)
+        {
+            return EncodeDynamic([&] {
+                for (auto const& entry : value)
+                {
+                    if (! EncodeValue(entry.first)
+                        || ! EncodeValue(entry.second))
+                    {
+                        return false;
+                    }
+                }
+                return true;
+            });
+        }
+        else if constexpr (internal::TupleLike<T>)
+        {
+            return [&]<std::size_t... I>(std::index_sequence<I...>) {
+                using std::get;
+                return (EncodeValue(get<I>(value)) && ...);
+            }(std::make_index_sequence<std::tuple_size_v<T>>{});
+        }
+        else
+        {
+            static_assert(internal::HasSerializationMembers<T>,
+                          "Type cannot be encoded; specialize "
+                          "SerializationMembers");
+            return false;
+        }
+    }
+
+    Span<Byte>  buffer;
+    std::size_t offset = 0;
+};
+
+/**
+ * @brief Decodes values from a SOME/IP payload written as by SomeIpEncoder.
+ *
+ * The input is checked, so it may come from an untrusted source.
+ *
+ * @tparam Config deployment parameters.
+ */
+template<SomeIpConfig Config = SomeIpConfig{}> class SomeIpDecoder final
+{
+    static_assert(internal::IsValid(Config), "Invalid SomeIpConfig");
+
+ public:
+    /**
+     * @brief Construct a decoder reading from the beginning of a payload.
+     *
+     * @param buffer the payload, which shall outlive the decoder.
+     */
+    explicit SomeIpDecoder(Span<Byte const> buffer) noexcept : buffer{buffer}
+    {}
+
+    /**
+     * @brief Reads the next value.
+     *
+     * Vectors and Maps are replaced by the elements read; their elements shall
+     * be default constructible. Missing padding at the end of the payload is
+     * accepted.
+     *
+     * @param value receives the value.
+     * @return std::optional<ErrorCode> empty on success;
+     * CoreErrc::kInvalidArgument with the offset of the offending data as
+     * support data if the payload is truncated or a length field does not
+     * match the data.
+     */
+    template<typename T> std::optional<ErrorCode> Decode(T& value)
+    {
+        std::size_t const start = offset;
+        if (! DecodeValue(value))
+        {
+            std::size_t const failed = offset;
+            offset                   = start;
+            return internal::MakeSomeIpError(failed);
+        }
+        return std::nullopt;
+    }
+
+    /**
+     * @brief Returns the number of bytes read so far.
+     */
+    std::size_t Offset() const noexcept { return offset; }
+
+    /**
+     * @brief Returns the bytes not read yet.
+     */
+    Span<Byte const> Remaining() const noexcept
+    {
+        return buffer.subspan(offset);
+    }
+
+ private:
+    using LengthType = internal::SomeIpLengthType<Config.lengthFieldSize>;
+
+    bool Fits(std::size_t size) const noexcept
+    {
+        return size <= buffer.size() - offset;
+    }
+
+    template<typename T> bool DecodeScalar(T& value) noexcept
+    {
+        if constexpr (std::is_same_v<T, Byte>)
+        {
+            if (! Fits(1))
+            {
+                return false;
+            }
+            value = buffer[offset++];
+            return true;
+        }
+        else if constexpr (std::is_same_v<T, bool>)
+        {
+            std::uint8_t raw;
+            if (! DecodeScalar(raw))
+            {
+                return false;
+            }
+            value = raw != 0;
+            return true;
+        }
+        else if constexpr (std::is_enum_v<T>)
+        {
+            std::underlying_type_t<T> raw;
+            if (! DecodeScalar(raw))
+            {
+                return false;
+            }
+            value = static_cast<T>(raw);
+            return true;
+        }
+        else if constexpr (std::is_floating_point_v<T>)
+        {
+            internal::SomeIpFloatBits<T> raw;
+            if (! DecodeScalar(raw))
+            {
+                return false;
+            }
+            value = std::bit_cast<T>(raw);
+            return true;
+        }
+        else
+        {
+            if (! Fits(sizeof(T)))
+            {
+                return false;
+            }
+            value = LoadInteger<T, std::endian::big>(
+              buffer.subspan(offset).template first<sizeof(T)>());
+            offset += sizeof(T);
+            return true;
+        }
+    }
+
+    template<typename T> bool DecodeRun(T* data, std::size_t size) noexcept
+    {
+        if constexpr (internal::SomeIpByteScalar<T>)
+        {
+            if (! Fits(size))
+            {
+                return false;
+            }
+            if (size > 0)
+            {
+                std::memcpy(static_cast<void*>(data),
+                            static_cast<void const*>(buffer.data() + offset),
+                            size);
+            }
+            offset += size;
+            return true;
+        }
+        else if constexpr (std::is_integral_v<T> && ! std::is_same_v<T, bool>)
+        {
+            if (size > (buffer.size() - offset) / sizeof(T))
+            {
+                return false;
+            }
+            LoadIntegers<std::endian::big>(buffer.subspan(offset),
+                                           Span<T>{data, size});
+            offset += size * sizeof(T);
+            return true;
+        }
+        else
+        {
+            for (std::size_t i = 0; i < size; ++i)
+            {
+                if (! DecodeValue(data[i]))
+                {
+                    return false;
+                }
+            }
+            return true;
+        }
+    }
+
+    /**
+     * Read a dynamic length array: its length field, the elements with the
+     * given function, which shall consume exactly length bytes, and the
+     * padding.
+     */
+    template<typename F> bool DecodeDynamic(F&& decodeElements)
+    {
+        LengthType length;
+        if (! DecodeScalar(length) || ! Fits(length))
+        {
+            return false;
+        }
+        std::size_t const end = offset + length;
+        if (! decodeElements(std::size_t{length}) || offset != end)
+        {
+            return false;
+        }
+        std::size_t const aligned =
+          (offset + Config.alignment - 1) / Config.alignment * Config.alignment;
+        offset = aligned < buffer.size() ? aligned : buffer.size();
+        return true;
+    }
+
+    template<typename T> bool DecodeValue(T& value)
+    {
+        if constexpr (internal::HasSerializationMembers<T>)
+        {
+            return std::apply(
+              [&](auto... members) {
+                  return (DecodeValue(value.*members) && ...);
+              },
+              SerializationMembers<T>::members);
+        }
+        else if constexpr (internal::SomeIpScalar<T>)
+        {
+            return DecodeScalar(value);
+        }
+        else if constexpr (internal::IsSomeIpArray<T>::value)
+        {
+            return DecodeRun(value.data(), value.size());
+        }
+        else if constexpr (internal::IsVector<T>::value)
+        {
+            using Element = typename T::value_type;
+            return DecodeDynamic([&](std::size_t length) {
+                if constexpr (internal::SomeIpScalar<Element>)
+                {
+                    if (length % sizeof(Element) != 0)
+                    {
+                        return false;
+                    }
+                    value.resize(length / sizeof(Element));
+                    return DecodeRun(value.data(), value.size());
+                }
+                else
+                {
+                    std::size_t const end = offset + length;
+                    value.clear();
+                    while (offset < end)
+                    {
+                        std::size_t const start = offset;
+                        value.emplace_back();
+                        // an element which consumes no bytes would never end
+                        if (! DecodeValue(value.back()) || offset == start)
+                        {
+                            return false;
+                        }
+                    }
+                    return true;
+                }
+            });
+        }
+        else if constexpr (internal::IsMap<T>::value)
+        {
+            return DecodeDynamic([&](std::size_t length) {
+                std::size_t const end = offset + length;
+                value.clear();
+                while (offset < end)
+                {
+                    std::size_t const       start = offset;
+                    typename T::key_type    key{};
+                    typename T::mapped_type mapped{};
+                    if (! DecodeValue(key) || ! DecodeValue(mapped)
+                        || offset == start)
+                    {
+                        return false;
+                    }
+                    value.emplace(std::move(key), std::move(mapped));
+                }
+                return true;
+            });
+        }
+        else if constexpr (internal::TupleLike<T>)
+        {
+            return [&]<std::size_t... I>(std::index_sequence<I...>) {
+                using std::get;
+                return (DecodeValue(get<I>(value)) && ...);
+            }(std::make_index_sequence<std::tuple_size_v<T>>{});
+        }
+        else
+        {
+            static_assert(internal::HasSerializationMembers<T>,
+                          "Type cannot be decoded; specialize "
+                          "SerializationMembers");
+            return false;
+        }
+    }
+
+    Span<Byte const> buffer;
+    std::size_t      offset = 0;
+};
+
+}  // namespace ara::core
+
+#endif  // ARA_CORE_SOMEIP_H_
@@ -0,0 +1,28 @@
+/**
+ * Copyright (c) 2020
+ * umlaut Software Development and contributors
+ *
+ * SPDX-License-Identifier: MIT
+ */
+#ifndef ARA_CORE_SPAN_H_
+#define ARA_CORE_SPAN_H_
+
+#include <cstddef>  // std::size_t
+#include <span>
+
+namespace ara::core {
+
+/**
+ * A constant for creating Spans with dynamic sizes.
+ *
+ * @req {SWS_CORE_01901}
+ */
+inline constexpr std::size_t dynamic_extent = std::dynamic_extent;
+
+// temporary solution:
+template<typename T, std::size_t Extent = dynamic_extent> using Span =
+  std::span<T, Extent>;
+
+}  // namespace ara::core
+
+#endif  // ARA_CORE_SPAN_H_
@@ -0,0 +1,496 @@
+/**
+ * Copyright (c) 2020
+ * umlaut Software Development and contributors
+ *
+ * SPDX-License-Identifier: MIT
+ */
+#ifndef ARA_CORE_SPSCRING_H_
+#define ARA_CORE_SPSCRING_H_
+
+#include <algorithm>  // std::min, std::copy_n
+#include <atomic>
+#include <cstddef>  // std::size_t
+#include <cstdint>
+#include <cstring>   // std::memcpy
+#include <iterator>  // std::make_move_iterator
+#include <optional>
+#include <type_traits>
+#include <utility>  // std::move
+
+#include "ara/core/internal/cache_line.h"
+#include "ara/core/span.h"
+#include "ara/core/utility.h"
+
+namespace ara::core {
+
+namespace internal {
+
+/**
+ * Free-running read and write indices of a single producer single consumer
+ * ring of N slots.
+ *
+ * Each index shares its cache line only with the copy of the other index
+ * cached by the same thread, which is refreshed only when the cached copy
+ * shows too little space, so producer and consumer touch each other's line
+ * about once per wrap around instead of once per element.
+ */
+template<std::size_t N> class SpscIndices final
+{
+ public:
+    /**
+     * Producer: index of the next slot to write.
+     */
+    std::size_t WriteIndex() const noexcept
+    {
+        return tail_.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * Producer: number of free slots, at least wanted if that many are free.
+     */
+    std::size_t Writable(std::size_t wanted) noexcept
+    {
+        std::size_t const tail = WriteIndex();
+        if (N - (tail - cachedHead_) < wanted)
+        {
+            cachedHead_ = head_.load(std::memory_order_acquire);
+        }
+        return N - (tail - cachedHead_);
+    }
+
+    /**
+     * Producer: publish count written slots.
+     */
+    void Produce(std::size_t count) noexcept
+    {
+        tail_.store(WriteIndex() + count, std::memory_order_release);
+    }
+
+    /**
+     * Consumer: index of the next slot to read.
+     */
+    std::size_t ReadIndex() const noexcept
+    {
+        return head_.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * Consumer: number of filled slots, at least wanted if that many are
+     * filled.
+     */
+    std::size_t Readable(std::size_t wanted) noexcept
+    {
+        std::size_t const head = ReadIndex();
+        if (cachedTail_ - head < wanted)
+        {
+            cachedTail_ = tail_.load(std::memory_order_acquire);
+        }
+        return cachedTail_ - head;
+    }
+
+    /**
+     * Consumer: release count read slots to the producer.
+     */
+    void Consume(std::size_t count) noexcept
+    {
+        head_.store(ReadIndex() + count, std::memory_order_release);
+    }
+
+    /**
+     * Number of filled slots; exact only when called by a thread while the
+     * other one is idle.
+     */
+    std::size_t Size() const noexcept
+    {
+        std::size_t const head = head_.load(std::memory_order_acquire);
+        std::size_t const tail = tail_.load(std::memory_order_acquire);
+        return std::min(tail - head, N);
+    }
+
+ private:
+    alignas(kCacheLineSize) std::atomic<std::size_t> tail_{0};
+    std::size_t cachedHead_{0};
+    alignas(kCacheLineSize) std::atomic<std::size_t> head_{0};
+    std::size_t cachedTail_{0};
+};
+
+}  // namespace internal
+
+/**
+ * @brief Bounded lock-free queue from a single producer thread to a single
+ * consumer thread.
+ *
+ * The elements are stored inline, so the queue never allocates. Elements are
+ * published in batches by PushBatch() and CommitWrite(), so a producer which
+ * writes many elements at once pays for a single release store. Popped slots
+ * keep their moved-from values until they are overwritten.
+ *
+ * All member functions named for the producer shall be called by one thread,
+ * and those named for the consumer by one other thread.
+ *
+ * @tparam T the element type; default constructible and move assignable.
+ * @tparam N the capacity, a power of 2.
+ */
+template<typename T, std::size_t N> class SpscRing final
+{
+    static_assert(N > 0 && (N & (N - 1)) == 0, "capacity must be power of 2");
+    static_assert(std::is_default_constructible_v<T>
+                    && std::is_move_assignable_v<T>,
+                  "elements must be default constructible and assignable");
+
+ public:
+    using value_type = T;
+    using size_type  = std::size_t;
+
+    /**
+     * @brief Construct an empty ring.
+     */
+    SpscRing() = default;
+
+    SpscRing(SpscRing const&) = delete;
+    SpscRing& operator=(SpscRing const&) = delete;
+
+    /**
+     * @brief Returns the maximum number of elements.
+     */
+    static constexpr size_type Capacity() noexcept { return N; }
+
+    /**
+     * @brief Producer: append a copy of an element.
+     *
+     * @return bool false if the ring is full.
+     */
+    bool TryPush(T const& value) noexcept(std::is_nothrow_copy_assignable_v<T>)
+    {
+        if (indices_.Writable(1) == 0)
+        {
+            return false;
+        }
+        slots_[indices_.WriteIndex() & kMask] = value;
+        indices_.Produce(1);
+        return true;
+    }
+
+    /**
+     * @brief Producer: append an element.
+     *
+     * @return bool false if the ring is full, value is unchanged then.
+     */
+    bool TryPush(T&& value) noexcept(std::is_nothrow_move_assignable_v<T>)
+    {
+        if (indices_.Writable(1) == 0)
+        {
+            return false;
+        }
+        slots_[indices_.WriteIndex() & kMask] = std::move(value);
+        indices_.Produce(1);
+        return true;
+    }
+
+    /**
+     * @brief Consumer: remove the oldest element.
+     *
+     * @return std::optional<T> the element, empty if the ring is empty.
+     */
+    std::optional<T> TryPop() noexcept(std::is_nothrow_move_constructible_v<T>)
+    {
+        if (indices_.Readable(1) == 0)
+        {
+            return std::nullopt;
+        }
+        std::optional<T> value{std::move(slots_[indices_.ReadIndex() & kMask])};
+        indices_.Consume(1);
+        return value;
+    }
+
+    /**
+     * @brief Producer: append copies of as many elements of a range as fit.
+     *
+     * The elements are published together.
+     *
+     * @return size_type the number of elements appended, a prefix of values.
+     */
+    size_type PushBatch(Span<T const> values)
+    {
+        size_type const count =
+          std::min(values.size(), indices_.Writable(values.size()));
+        size_type const offset = indices_.WriteIndex() & kMask;
+        size_type const first  = std::min(count, N - offset);
+        std::copy_n(values.data(), first, slots_ + offset);
+        std::copy_n(values.data() + first, count - first, slots_);
+        indices_.Produce(count);
+        return count;
+    }
+
+    /**
+     * @brief Consumer: remove the oldest elements into a range.
+     *
+     * @return size_type the number of elements moved to the front of out.
+     */
+    size_type PopBatch(Span<T> out)
+    {
+        size_type const count =
+          std::min(out.size(), indices_.Readable(out.size()));
+        size_type const offset = indices_.ReadIndex() & kMask;
+        size_type const first  = std::min(count, N - offset);
+        std::copy_n(
+          std::make_move_iterator(slots_ + offset), first, out.data());
+        std::copy_n(
+          std::make_move_iterator(slots_), count - first, out.data() + first);
+        indices_.Consume(count);
+        return count;
+    }
+
+    /**
+     * @brief Producer: the free slots which follow the last element without
+     * wrapping around, to be filled in place and published by CommitWrite().
+     *
+     * @return Span<T> the slots, empty if the ring is full.
+     */
+    Span<T> WriteRegion() noexcept
+    {
+        size_type const offset = indices_.WriteIndex() & kMask;
+        size_type const free   = indices_.Writable(N - offset);
+        return Span<T>{slots_ + offset, std::min(free, N - offset)};
+    }
+
+    /**
+     * @brief Producer: publish the first count slots of WriteRegion().
+     */
+    void CommitWrite(size_type count) noexcept { indices_.Produce(count); }
+
+    /**
+     * @brief Consumer: the oldest elements which are stored without wrapping
+     * around, to be used in place and released by CommitRead().
+     *
+     * @return Span<T> the elements, empty if the ring is empty.
+     */
+    Span<T> ReadRegion() noexcept
+    {
+        size_type const offset = indices_.ReadIndex() & kMask;
+        size_type const filled = indices_.Readable(N - offset);
+        return Span<T>{slots_ + offset, std::min(filled, N - offset)};
+    }
+
+    /**
+     * @brief Consumer: release the first count elements of ReadRegion().
+     */
+    void CommitRead(size_type count) noexcept { indices_.Consume(count); }
+
+    /**
+     * @brief Returns the number of elements; a snapshot while the other
+     * thread is active.
+     */
+    size_type Size() const noexcept { return indices_.Size(); }
+
+    /**
+     * @brief Checks whether the ring is empty; a snapshot while the other
+     * thread is active.
+     */
+    bool Empty() const noexcept { return Size() == 0; }
+
+ private:
+    static constexpr size_type kMask = N - 1;
+
+    internal::SpscIndices<N> indices_;
+    T                        slots_[N];
+};
+
+/**
+ * @brief Single producer single consumer ring of variable length Byte frames.
+ *
+ * Each frame is stored in place as a 4 byte length followed by its bytes,
+ * padded to a multiple of 4 bytes, so frames are neither allocated nor copied
+ * by the ring. A frame is never split at the end of the buffer: the producer
+ * marks the remainder as skipped instead, so every frame is a contiguous
+ * Span. Frame data is aligned to 4 bytes.
+ *
+ * All member functions named for the producer shall be called by one thread,
+ * and those named for the consumer by one other thread.
+ *
+ * @tparam N the size of the buffer in bytes, a power of 2 of at least 8.
+ */
+template<std::size_t N> class SpscFrameRing final
+{
+    static_assert(N >= 8 && (N & (N - 1)) == 0, "size must be power of 2");
+
+ public:
+    using size_type = std::size_t;
+
+    /**
+     * @brief Construct an empty ring.
+     */
+    SpscFrameRing() = default;
+
+    SpscFrameRing(SpscFrameRing const&) = delete;
+    SpscFrameRing& operator=(SpscFrameRing const&) = delete;
+
+    /**
+     * @brief Returns the size of the largest frame which fits.
+     *
+     * Half of the buffer, so that a frame fits into the empty ring whatever
+     * the write index: the remainder skipped at the end of the buffer is
+     * shorter than the frame.
+     */
+    static constexpr size_type MaxFrameSize() noexcept
+    {
+        return N / 2 - kHeaderSize;
+    }
+
+    /**
+     * @brief Producer: reserve space for a frame, to be written in place and
+     * published by CommitFrame().
+     *
+     * A later call discards an uncommitted reservation.
+     *
+     * @param size the maximum size of the frame.
+     * @return std::optional<Span<Byte>> the frame data, empty if the ring is
+     * too full or size exceeds MaxFrameSize().
+     */
+    std::optional<Span<Byte>> TryBeginFrame(size_type size) noexcept
+    {
+        if (size > MaxFrameSize())
+        {
+            return std::nullopt;
+        }
+        size_type const offset = indices_.WriteIndex() & kMask;
+        size_type const toEnd  = N - offset;
+        size_type const needed = RecordSize(size);
+        size_type const skip   = needed <= toEnd ? 0 : toEnd;
+        if (indices_.Writable(skip + needed) < skip + needed)
+        {
+            return std::nullopt;
+        }
+        skip_     = skip;
+        reserved_ = size;
+        return Span<Byte>{buffer_ + (offset + skip) % N + kHeaderSize, size};
+    }
+
+    /**
+     * @brief Producer: publish the frame reserved by TryBeginFrame().
+     *
+     * @param size the actual size of the frame, at most the reserved one.
+     */
+    void CommitFrame(size_type size) noexcept
+    {
+        size_type const offset = indices_.WriteIndex() & kMask;
+        if (skip_ != 0)
+        {
+            StoreHeader(offset, kSkipMarker);
+        }
+        StoreHeader((offset + skip_) % N,
+                    static_cast<std::uint32_t>(std::min(size, reserved_)));
+        indices_.Produce(skip_ + RecordSize(std::min(size, reserved_)));
+        skip_ = 0;
+    }
+
+    /**
+     * @brief Producer: append a copy of a frame.
+     *
+     * @return bool false if the frame does not fit.
+     */
+    bool TryPushFrame(Span<Byte const> frame) noexcept
+    {
+        auto const data = TryBeginFrame(frame.size());
+        if (! data)
+        {
+            return false;
+        }
+        if (! frame.empty())
+        {
+            std::memcpy(data->data(), frame.data(), frame.size());
+        }
+        CommitFrame(frame.size());
+        return true;
+    }
+
+    /**
+     * @brief Consumer: the oldest frame, valid until PopFrame().
+     *
+     * @return std::optional<Span<Byte const>> the frame data, empty if the
+     * ring is empty.
+     */
+    std::optional<Span<Byte const>> TryFrontFrame() noexcept
+    {
+        auto const offset = FrontOffset();
+        if (! offset)
+        {
+            return std::nullopt;
+        }
+        return Span<Byte const>{buffer_ + *offset + kHeaderSize,
+                                LoadHeader(*offset)};
+    }
+
+    /**
+     * @brief Consumer: remove the oldest frame.
+     *
+     * @return bool false if the ring is empty.
+     */
+    bool PopFrame() noexcept
+    {
+        auto const offset = FrontOffset();
+        if (! offset)
+        {
+            return false;
+        }
+        indices_.Consume(RecordSize(LoadHeader(*offset)));
+        return true;
+    }
+
+    /**
+     * @brief Checks whether the ring holds no frame; a snapshot while the
+     * other thread is active.
+     */
+    bool Empty() const noexcept { return indices_.Size() == 0; }
+
+ private:
+    static constexpr size_type     kMask       = N - 1;
+    static constexpr size_type     kHeaderSize = sizeof(std::uint32_t);
+    static constexpr std::uint32_t kSkipMarker = 0xFFFFFFFF;
+
+    static constexpr size_type RecordSize(size_type size) noexcept
+    {
+        return (kHeaderSize + size + kHeaderSize - 1) & ~(kHeaderSize - 1);
+    }
+
+    void StoreHeader(size_type offset, std::uint32_t value) noexcept
+    {
+        std::memcpy(static_cast<void*>(buffer_ + offset), &value, kHeaderSize);
+    }
+
+    std::uint32_t LoadHeader(size_type offset) const noexcept
+    {
+        std::uint32_t value;
+        std::memcpy(&value, buffer_ + offset, kHeaderSize);
+        return value;
+    }
+
+    /**
+     * Offset of the header of the oldest frame, after consuming a skipped
+     * remainder of the buffer before it.
+     */
+    std::optional<size_type> FrontOffset() noexcept
+    {
+        if (indices_.Readable(1) == 0)
+        {
+            return std::nullopt;
+        }
+        size_type const offset = indices_.ReadIndex() & kMask;
+        if (LoadHeader(offset) != kSkipMarker)
+        {
+            return offset;
+        }
+        // the skipped remainder is published together with the next frame
+        indices_.Consume(N - offset);
+        return 0;
+    }
+
+    internal::SpscIndices<N> indices_;
+    size_type                skip_{0};
+    size_type                reserved_{0};
+    alignas(kHeaderSize) Byte buffer_[N];
+};
+
+}  // namespace ara::core
+
+#endif  // ARA_CORE_SPSCRING_H_
@@ -0,0 +1,154 @@
+/**
+ * Copyright (c) 2020
+ * umlaut Software Development and contributors
+ *
+ * SPDX-License-Identifier: MIT
+ */
+#ifndef ARA_CORE_STATICERRORDOMAIN_H_
+#define ARA_CORE_STATICERRORDOMAIN_H_
+
+#include <type_traits>
+
+#include "ara/core/error_code.h"
+#include "ara/core/error_domain.h"
+#include "ara/core/string_view.h"
+
+namespace ara::core {
+
+/**
+ * Base class of error domains whose name, messages and exception type are
+ * known at compile time.
+ *
+ * Implements the virtual interface of ErrorDomain once for all such domains,
+ * and additionally provides it as static functions, so call sites which know
+ * the domain type skip the virtual dispatch. The virtual functions are
+ * constexpr, so they can also be evaluated at compile time through an
+ * ErrorDomain reference to a constexpr domain.
+ *
+ * @tparam Derived the domain type, which shall provide
+ *   - a type alias Exception, the exception type thrown for its errors,
+ *   - a static constexpr FixedString name, the shortname of the domain,
+ *   - a static constexpr ErrorDomain::MessageTable reference messageTable.
+ */
+template<typename Derived> class StaticErrorDomain : public ErrorDomain
+{
+ public:
+    /**
+     * Return the name of the domain, without virtual dispatch.
+     *
+     * @return StringView the name
+     */
+    static constexpr StringView StaticName() noexcept { return Derived::name; }
+
+    /**
+     * Return the message of the given code value, without virtual dispatch.
+     *
+     * @param errorCode the domain-specific error code
+     * @return StringView the message, null-terminated
+     */
+    static constexpr StringView StaticMessage(CodeType errorCode) noexcept
+    {
+        return Derived::messageTable.Lookup(errorCode);
+    }
+
+    /**
+     * Throw the exception type of the domain, without virtual dispatch.
+     *
+     * @param errorCode the ErrorCode to throw
+     */
+    [[noreturn]] static void StaticThrowAsException(ErrorCode const& errorCode)
+    {
+        throw typename Derived::Exception(errorCode);
+    }
+
+    /**
+     * Return the name of this error domain.
+     *
+     * @return char const* the name as a null-terminated string, never nullptr
+     */
+    constexpr char const* Name() const noexcept override
+    {
+        return StaticName().data();
+    }
+
+    /**
+     * Return a textual representation of the given error code.
+     *
+     * @param errorCode the domain-specific error code
+     * @return char const* the text as a null-terminated string, never nullptr
+     */
+    constexpr char const* Message(CodeType errorCode) const noexcept override
+    {
+        return StaticMessage(errorCode).data();
+    }
+
+    /**
+     * Throw the exception type of this domain for the given error.
+     *
+     * @param errorCode the ErrorCode
+     */
+    void ThrowAsException(ErrorCode const& errorCode) const override
+    {
+        StaticThrowAsException(errorCode);
+    }
+
+ protected:
+    /**
+     * Construct a new instance with the given identifier, using the message
+     * table of Derived.
+     *
+     * @param id the unique identifier
+     */
+    explicit constexpr StaticErrorDomain(IdType id) noexcept
+      : ErrorDomain{id, Derived::messageTable}
+    {}
+
+    /**
+     * Destructor, see ErrorDomain::~ErrorDomain().
+     */
+    ~StaticErrorDomain() = default;
+};
+
+/**
+ * Map an error code enumeration to the StaticErrorDomain it belongs to.
+ *
+ * Specialize with a member alias type naming the domain.
+ *
+ * @tparam EnumT the error code enumeration
+ */
+template<typename EnumT> struct StaticErrorDomainOf
+{};
+
+/**
+ * Return the message of the given error code value, resolving the domain at
+ * compile time.
+ *
+ * @param e the error code value
+ * @return StringView the message, null-terminated
+ */
+template<typename EnumT,
+         typename Domain = typename StaticErrorDomainOf<EnumT>::type>
+constexpr StringView ErrorMessage(EnumT e) noexcept
+{
+    return Domain::StaticMessage(static_cast<ErrorDomain::CodeType>(e));
+}
+
+/**
+ * Throw the given error as exception, resolving the domain and its exception
+ * type at compile time.
+ *
+ * @param e the error code value
+ * @param data optional vendor-specific supplementary error context data
+ */
+template<typename EnumT,
+         typename Domain = typename StaticErrorDomainOf<EnumT>::type>
+[[noreturn]] void
+ThrowError(EnumT                        e,
+           ErrorDomain::SupportDataType data = ErrorDomain::SupportDataType())
+{
+    Domain::StaticThrowAsException(MakeErrorCode(e, data));
+}
+
+}  // namespace ara::core
+
+#endif  // ARA_CORE_STATICERRORDOMAIN_H_
@@ -0,0 +1,228 @@
+/**
+ * Copyright (c) 2020
+ * umlaut Software Development and contributors
+ *
+ * SPDX-License-Identifier: MIT
+ */
+#ifndef ARA_CORE_STRINGINTERNER_H_
+#define ARA_CORE_STRINGINTERNER_H_
+
+#include <atomic>
+#include <cstddef>  // std::size_t
+#include <cstdint>  // uint64_t
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "ara/core/string_view.h"
+
+namespace ara::core {
+
+namespace internal {
+
+/**
+ * A string stored in the arena of a StringInterner, immediately followed by
+ * its null-terminated characters.
+ */
+struct InternedEntry
+{
+    std::uint64_t hash;
+    StringView    view;
+};
+
+}  // namespace internal
+
+/**
+ * Handle to a unique string owned by a StringInterner.
+ *
+ * Handles are as cheap to copy as a pointer. Two handles obtained from the same
+ * interner compare equal exactly if they refer to equal strings.
+ */
+class InternedString final
+{
+ public:
+    /**
+     * Construct an empty handle, which does not refer to any string.
+     */
+    constexpr InternedString() noexcept = default;
+
+    /**
+     * Check if the handle refers to a string.
+     */
+    constexpr explicit operator bool() const noexcept
+    {
+        return entry != nullptr;
+    }
+
+    /**
+     * Return the interned string.
+     *
+     * @return StringView the characters, which stay valid for the lifetime of
+     * the interner and are null-terminated; empty for an empty handle
+     */
+    constexpr StringView View() const noexcept
+    {
+        return entry != nullptr ? entry->view : StringView{};
+    }
+
+    /**
+     * Return the hash of the interned string, computed when it was added.
+     *
+     * @return std::uint64_t the FNV-1a hash; 0 for an empty handle
+     */
+    constexpr std::uint64_t Hash() const noexcept
+    {
+        return entry != nullptr ? entry->hash : 0;
+    }
+
+    /**
+     * Compare two handles by identity.
+     */
+    constexpr bool operator==(InternedString const& other) const noexcept
+    {
+        return entry == other.entry;
+    }
+
+    /**
+     * Compare two handles by identity.
+     */
+    constexpr bool operator!=(InternedString const& other) const noexcept
+    {
+        return ! (*this == other);
+    }
+
+ private:
+    friend class StringInterner;
+
+    constexpr explicit InternedString(
+      internal::InternedEntry const* entry) noexcept
+      : entry{entry}
+    {}
+
+    internal::InternedEntry const* entry = nullptr;
+};
+
+/**
+ * Table of unique strings.
+ *
+ * Looking up a string which is already present is lock-free. Only adding a new
+ * string takes a lock; its characters are copied into arena pages owned by the
+ * interner and never move afterwards.
+ */
+class StringInterner final
+{
+ public:
+    /**
+     * Number of lookups that found an existing string (hits) and of
+     * lookups that had to insert it (misses). A Find() which finds nothing
+     * counts as neither.
+     */
+    struct Statistics
+    {
+        std::uint64_t hits;
+        std::uint64_t misses;
+    };
+
+    /**
+     * Return the process-wide interner.
+     *
+     * @return StringInterner& the global interner
+     */
+    static StringInterner& Global() noexcept;
+
+    /**
+     * Return the statistics of all interners for the calling thread.
+     *
+     * @return Statistics the hit/miss counters of the calling thread
+     */
+    static Statistics ThreadStatistics() noexcept;
+
+    /**
+     * Reset the statistics of the calling thread.
+     */
+    static void ResetThreadStatistics() noexcept;
+
+    /**
+     * Construct an empty interner.
+     */
+    StringInterner();
+
+    /**
+     * Destructor, invalidates all handles obtained from this interner.
+     */
+    ~StringInterner();
+
+    StringInterner(StringInterner const&) = delete;
+    StringInterner& operator=(StringInterner const&) = delete;
+
+    /**
+     * Return the handle to the given string, adding it if not yet present.
+     *
+     * @param s the string
+     * @return InternedString handle to the unique copy of s
+     */
+    InternedString Intern(StringView s);
+
+    /**
+     * Return the handle to the given string, without adding it.
+     *
+     * @param s the string
+     * @return InternedString handle to the unique copy of s, or an empty
+     * handle if s was not interned yet
+     */
+    InternedString Find(StringView s) const noexcept;
+
+    /**
+     * Return the number of unique strings.
+     */
+    std::size_t Size() const noexcept;
+
+ private:
+    struct Table;
+
+    internal::InternedEntry const*
+    Lookup(std::uint64_t hash, StringView s) const noexcept;
+    internal::InternedEntry const* Allocate(std::uint64_t hash, StringView s);
+    void                           Insert(internal::InternedEntry const* entry);
+
+    /**
+     * Current open-addressing table, read without locking.
+     */
+    std::atomic<Table*> table;
+    /**
+     * All tables ever published; retired ones are kept alive for concurrent
+     * readers.
+     */
+    std::vector<std::unique_ptr<Table>> tables;
+    /**
+     * Arena pages holding the entries and their characters.
+     */
+    std::vector<std::unique_ptr<char[]>> pages;
+    std::size_t                          pageUsed;
+    std::size_t                          pageCapacity;
+    std::atomic<std::size_t>             size;
+    /**
+     * Serializes insertions.
+     */
+    std::mutex mutex;
+};
+
+}  // namespace ara::core
+
+namespace std {
+
+/**
+ * Hash support for InternedString, using the precomputed hash value.
+ */
+template<> struct hash<ara::core::InternedString>
+{
+    std::size_t operator()(ara::core::InternedString const& s) const noexcept
+    {
+        return s.Hash();
+    }
+};
+
+}  // namespace std
+
+#endif  // ARA_CORE_STRINGINTERNER_H_
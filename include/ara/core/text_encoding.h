@@ -0,0 +1,159 @@
+/**
+ * Copyright (c) 2020
+ * umlaut Software Development and contributors
+ *
+ * SPDX-License-Identifier: MIT
+ */
+#ifndef ARA_CORE_TEXTENCODING_H_
+#define ARA_CORE_TEXTENCODING_H_
+
+#include <cstddef>  // std::size_t
+#include <cstdint>
+#include <optional>
+
+#include "ara/core/error_code.h"
+#include "ara/core/span.h"
+#include "ara/core/string_view.h"
+#include "ara/core/utility.h"
+
+namespace ara::core {
+
+/**
+ * @brief Case of the letters of hexadecimal digits.
+ */
+enum class HexCase : std::uint8_t
+{
+    kLower,
+    kUpper
+};
+
+/**
+ * @brief Returns the number of characters of the hexadecimal encoding of the
+ * given number of bytes.
+ */
+constexpr std::size_t HexEncodedSize(std::size_t size) noexcept
+{
+    return 2 * size;
+}
+
+/**
+ * @brief Writes two hexadecimal digits per byte, the high nibble first.
+ *
+ * @param in the bytes.
+ * @param out receives the digits; shall hold at least
+ * HexEncodedSize(in.size()) characters. No terminating null character is
+ * written.
+ * @param letterCase the case of the digits a to f.
+ * @return std::optional<ErrorCode> empty on success;
+ * CoreErrc::kInvalidArgument if out is too small, with the required size as
+ * support data; nothing is written then.
+ */
+std::optional<ErrorCode>
+EncodeHex(Span<Byte const> in,
+          Span<char>       out,
+          HexCase          letterCase = HexCase::kLower) noexcept;
+
+/**
+ * @brief Reads bytes written as two hexadecimal digits each, in any case.
+ *
+ * @param in the digits.
+ * @param out receives the in.size() / 2 bytes; may be larger.
+ * @return std::optional<ErrorCode> empty on success;
+ * CoreErrc::kInvalidArgument if a character is not a hexadecimal digit, with
+ * its offset as support data, if in has an odd number of characters, with
+ * in.size() as support data, or if out is too small, with the required size
+ * as support data.
+ */
+std::optional<ErrorCode> DecodeHex(StringView in, Span<Byte> out) noexcept;
+
+/**
+ * @brief Returns the number of characters of the base64 encoding of the given
+ * number of bytes, including padding.
+ */
+constexpr std::size_t Base64EncodedSize(std::size_t size) noexcept
+{
+    return (size + 2) / 3 * 4;
+}
+
+/**
+ * @brief Returns the number of bytes encoded by a base64 string.
+ *
+ * @param in the base64 string, with padding.
+ */
+constexpr std::size_t Base64DecodedSize(StringView in) noexcept
+{
+    std::size_t size = in.size() / 4 * 3;
+    for (std::size_t i = 0; i < 2 && size > 0 && in[in.size() - 1 - i] == '=';
+         ++i)
+    {
+        --size;
+    }
+    return size;
+}
+
+/**
+ * @brief Writes the base64 encoding of bytes, with the alphabet and padding
+ * of RFC 4648.
+ *
+ * @param in the bytes.
+ * @param out receives the encoding; shall hold at least
+ * Base64EncodedSize(in.size()) characters. No terminating null character is
+ * written.
+ * @return std::optional<ErrorCode> empty on success;
+ * CoreErrc::kInvalidArgument if out is too small, with the required size as
+ * support data; nothing is written then.
+ */
+std::optional<ErrorCode> EncodeBase64(Span<Byte const> in,
+                                      Span<char>       out) noexcept;
+
+/**
+ * @brief Reads the base64 encoding of bytes, with the alphabet and padding of
+ * RFC 4648.
+ *
+ * @param in the encoding; its size shall be a multiple of 4.
+ * @param out receives the Base64DecodedSize(in) bytes; may be larger.
+ * @return std::optional<ErrorCode> empty on success;
+ * CoreErrc::kInvalidArgument if a character is not part of the alphabet or
+ * misplaced padding, with its offset as support data, if the size of in is
+ * not a multiple of 4, with in.size() as support data, or if out is too
+ * small, with the required size as support data.
+ */
+std::optional<ErrorCode> DecodeBase64(StringView in, Span<Byte> out) noexcept;
+
+namespace internal {
+
+/**
+ * Kernels of one instruction set. The encoders process n bytes, a multiple of
+ * 3 for base64; the decoders n characters, a multiple of 2 or 4 without
+ * padding, and return n on success or the offset of the first invalid
+ * character.
+ */
+struct TextEncodingKernels
+{
+    char const* name;
+    void (*encodeHex)(std::uint8_t const* in,
+                      std::size_t         n,
+                      char*               out,
+                      char const*         digits) noexcept;
+    std::size_t (*decodeHex)(char const*   in,
+                             std::size_t   n,
+                             std::uint8_t* out) noexcept;
+    void (*encodeBase64)(std::uint8_t const* in,
+                         std::size_t         n,
+                         char*               out) noexcept;
+    std::size_t (*decodeBase64)(char const*   in,
+                                std::size_t   n,
+                                std::uint8_t* out) noexcept;
+};
+
+/**
+ * Kernels of the instruction sets the CPU supports: the portable ones first,
+ * the ones EncodeHex() and the other functions use last.
+ */
+Span<TextEncodingKernels const> SupportedTextEncodingKernels() noexcept;
+
+}  // namespace internal
+
+}  // namespace ara::core
+
+#endif  // ARA_CORE_TEXTENCODING_H_
@@ -0,0 +1,179 @@
+/**
+ * Copyright (c) 2020
+ * umlaut Software Development and contributors
+ *
+ * SPDX-License-Identifier: MIT
+ */
+#ifndef ARA_CORE_VARINT_H_
+#define ARA_CORE_VARINT_H_
+
+#include <concepts>  // std::unsigned_integral, std::signed_integral
+#include <cstddef>   // std::size_t
+#include <cstdint>
+#include <type_traits>
+
+#include "ara/core/span.h"
+#include "ara/core/utility.h"
+
+namespace ara::core {
+
+/**
+ * @brief Maximum number of bytes of the LEB128 encoding of a T.
+ */
+template<std::unsigned_integral T> constexpr std::size_t kMaxVarintSize =
+  (sizeof(T) * 8 + 6) / 7;
+
+/**
+ * @brief Maps a signed integer to an unsigned one, such that numbers of small
+ * magnitude map to small numbers: 0, -1, 1, -2, ... map to 0, 1, 2, 3, ...
+ *
+ * @param value the integer.
+ */
+template<std::signed_integral T> constexpr std::make_unsigned_t<T>
+ZigZagEncode(T value) noexcept
+{
+    using U = std::make_unsigned_t<T>;
+    return static_cast<U>(static_cast<U>(value) << 1)
+           ^ static_cast<U>(value >> (sizeof(T) * 8 - 1));
+}
+
+/**
+ * @brief Inverts ZigZagEncode().
+ *
+ * @param value the encoded integer.
+ */
+template<std::unsigned_integral T> constexpr std::make_signed_t<T>
+ZigZagDecode(T value) noexcept
+{
+    return static_cast<std::make_signed_t<T>>(
+      static_cast<T>(value >> 1) ^ static_cast<T>(0u - (value & 1u)));
+}
+
+/**
+ * @brief Returns the number of bytes of the LEB128 encoding of a value.
+ *
+ * @param value the value.
+ */
+template<std::unsigned_integral T> constexpr std::size_t
+VarintSize(T value) noexcept
+{
+    std::size_t size = 1;
+    for (; value >= 0x80; value = static_cast<T>(value >> 7)) { ++size; }
+    return size;
+}
+
+/**
+ * @brief Writes the unsigned LEB128 encoding of a value: 7 bits per byte,
+ * least significant group first, the most significant bit set on all bytes
+ * but the last.
+ *
+ * @param value the value.
+ * @param out receives the encoding; shall hold at least VarintSize(value)
+ * bytes.
+ * @return std::size_t number of bytes written.
+ */
+template<std::unsigned_integral T> constexpr std::size_t
+EncodeVarint(T value, Span<Byte> out) noexcept
+{
+    std::size_t size = 0;
+    for (; value >= 0x80; value = static_cast<T>(value >> 7))
+    {
+        out[size++] = Byte{static_cast<std::uint8_t>(value | 0x80)};
+    }
+    out[size++] = Byte{static_cast<std::uint8_t>(value)};
+    return size;
+}
+
+/**
+ * @brief Reads an unsigned LEB128 encoded value.
+ *
+ * @param in the encoding, possibly followed by other data.
+ * @param value receives the value.
+ * @return std::size_t number of bytes read; 0 if the encoding is truncated,
+ * longer than kMaxVarintSize<T> bytes or its value does not fit into a T.
+ */
+template<std::unsigned_integral T> constexpr std::size_t
+DecodeVarint(Span<Byte const> in, T& value) noexcept
+{
+    constexpr std::size_t bits = sizeof(T) * 8;
+
+    T result = 0;
+    for (std::size_t i = 0; i < in.size() && i < kMaxVarintSize<T>; ++i)
+    {
+        auto const        byte  = to_integer<std::uint8_t>(in[i]);
+        auto const        group = static_cast<T>(byte & 0x7F);
+        std::size_t const shift = 7 * i;
+        if (shift + 7 > bits && (group >> (bits - shift)) != 0)
+        {
+            return 0;
+        }
+        result = static_cast<T>(result | static_cast<T>(group << shift));
+        if ((byte & 0x80) == 0)
+        {
+            value = result;
+            return i + 1;
+        }
+    }
+    return 0;
+}
+
+/**
+ * @brief Result of a batched varint decoding.
+ */
+struct VarintDecodeResult
+{
+    /**
+     * Number of values decoded.
+     */
+    std::size_t values;
+    /**
+     * Number of bytes consumed.
+     */
+    std::size_t bytes;
+};
+
+/**
+ * @brief Writes the LEB128 encodings of values consecutively.
+ *
+ * @param values the values.
+ * @param out receives the encodings; shall hold at least the sum of their
+ * VarintSize() bytes.
+ * @return std::size_t number of bytes written.
+ */
+std::size_t EncodeVarints(Span<std::uint32_t const> values,
+                          Span<Byte>                out) noexcept;
+
+/**
+ * @copydoc EncodeVarints(Span<std::uint32_t const>, Span<Byte>)
+ */
+std::size_t EncodeVarints(Span<std::uint64_t const> values,
+                          Span<Byte>                out) noexcept;
+
+/**
+ * @brief Reads consecutive LEB128 encoded values.
+ *
+ * The continuation bits of 16 input bytes are gathered into a mask at once
+ * (with SSE2 where available), so the length of each varint is a count of
+ * trailing zeros, and each varint of up to 8 bytes is decoded from a single
+ * 64 bit load with a branch-free compaction of its 7 bit groups. A block of
+ * 16 single byte varints is widened without further inspection.
+ *
+ * Decoding stops when out is full, at the end of the input or at the first
+ * malformed varint, see DecodeVarint().
+ *
+ * @param in the encodings.
+ * @param out receives the values.
+ * @return VarintDecodeResult the number of values decoded and bytes consumed.
+ */
+VarintDecodeResult DecodeVarints(Span<Byte const>    in,
+                                 Span<std::uint32_t> out) noexcept;
+
+/**
+ * @copydoc DecodeVarints(Span<Byte const>, Span<std::uint32_t>)
+ */
+VarintDecodeResult DecodeVarints(Span<Byte const>    in,
+                                 Span<std::uint64_t> out) noexcept;
+
+}  // namespace ara::core
+
+#endif  // ARA_CORE_VARINT_H_
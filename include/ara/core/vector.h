@@ -40,8 +40,8 @@ template<class T, class Allocator = Allocator<T>> class Vector
     using const_reference  = const value_type&;
     using pointer          = typename AllocatorTraits<Allocator>::pointer;
     using const_pointer    = typename AllocatorTraits<Allocator>::const_pointer;
-    using iterator         = typename std::vector<T>::iterator;
-    using const_iterator   = typename std::vector<T>::const_iterator;
+    using iterator         = typename std::vector<T, Allocator>::iterator;
+    using const_iterator   = typename std::vector<T, Allocator>::const_iterator;
     using reverse_iterator = typename std::reverse_iterator<iterator>;
     using const_reverse_iterator =
       typename std::reverse_iterator<const_iterator>;
@@ -366,7 +366,7 @@ template<class T, class Allocator = Allocator<T>> class Vector
      *
      * @param[in] new_cap - new capacity of the vector.
      */
-    void reserve(size_type new_cap) { _impl.resize(new_cap); }
+    void reserve(size_type new_cap) { _impl.reserve(new_cap); }
 
     /**
      * @brief Requests the removal of unused capacity.
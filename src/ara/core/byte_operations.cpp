@@ -0,0 +1,253 @@
+#include "ara/core/byte_operations.h"
+
+#include <algorithm>  // std::min
+#include <cstdint>
+#include <cstring>  // std::memcpy
+
+#if defined(__x86_64__) && defined(__GNUC__)
+#    define ARA_CORE_BYTE_OPERATIONS_AVX2
+#    include <immintrin.h>
+#endif
+
+namespace ara::core {
+
+namespace {
+
+enum class BitwiseOp
+{
+    kAnd,
+    kOr,
+    kXor
+};
+
+using BinaryKernel = void (*)(std::uint8_t*,
+                              std::uint8_t const*,
+                              std::size_t) noexcept;
+using NotKernel      = void (*)(std::uint8_t*, std::size_t) noexcept;
+using PopCountKernel = std::size_t (*)(std::uint8_t const*,
+                                       std::size_t) noexcept;
+
+template<BitwiseOp Op> constexpr std::uint64_t
+Apply(std::uint64_t a, std::uint64_t b) noexcept
+{
+    if constexpr (Op == BitwiseOp::kAnd)
+    {
+        return a & b;
+    }
+    else if constexpr (Op == BitwiseOp::kOr)
+    {
+        return a | b;
+    }
+    else
+    {
+        return a ^ b;
+    }
+}
+
+/**
+ * Portable kernels, processing one 64 bit word per iteration.
+ */
+template<BitwiseOp Op> void
+ApplyScalar(std::uint8_t* dst, std::uint8_t const* src, std::size_t n) noexcept
+{
+    std::size_t i = 0;
+    for (; i + 8 <= n; i += 8)
+    {
+        std::uint64_t a;
+        std::uint64_t b;
+        std::memcpy(&a, dst + i, 8);
+        std::memcpy(&b, src + i, 8);
+        a = Apply<Op>(a, b);
+        std::memcpy(dst + i, &a, 8);
+    }
+    for (; i < n; ++i)
+    {
+        dst[i] = static_cast<std::uint8_t>(Apply<Op>(dst[i], src[i]));
+    }
+}
+
+void NotScalar(std::uint8_t* bytes, std::size_t n) noexcept
+{
+    std::size_t i = 0;
+    for (; i + 8 <= n; i += 8)
+    {
+        std::uint64_t a;
+        std::memcpy(&a, bytes + i, 8);
+        a = ~a;
+        std::memcpy(bytes + i, &a, 8);
+    }
+    for (; i < n; ++i) { bytes[i] = static_cast<std::uint8_t>(~bytes[i]); }
+}
+
+std::size_t PopCountScalar(std::uint8_t const* bytes, std::size_t n) noexcept
+{
+    std::size_t count = 0;
+    std::size_t i     = 0;
+    for (; i + 8 <= n; i += 8)
+    {
+        std::uint64_t a;
+        std::memcpy(&a, bytes + i, 8);
+        count += static_cast<std::size_t>(__builtin_popcountll(a));
+    }
+    for (; i < n; ++i)
+    {
+        count += static_cast<std::size_t>(__builtin_popcount(bytes[i]));
+    }
+    return count;
+}
+
+#ifdef ARA_CORE_BYTE_OPERATIONS_AVX2
+/**
+ * AVX2 kernels, processing 32 bytes per iteration; the remainder is handled by
+ * the portable kernels.
+ */
+template<BitwiseOp Op> __attribute__((target("avx2"))) void
+ApplyAvx2(std::uint8_t* dst, std::uint8_t const* src, std::size_t n) noexcept
+{
+    std::size_t i = 0;
+    for (; i + 32 <= n; i += 32)
+    {
+        auto* const   d = reinterpret_cast<__m256i*>(dst + i);
+        __m256i const a = _mm256_loadu_si256(d);
+        __m256i const b =
+          _mm256_loadu_si256(reinterpret_cast<__m256i const*>(src + i));
+        if constexpr (Op == BitwiseOp::kAnd)
+        {
+            _mm256_storeu_si256(d, _mm256_and_si256(a, b));
+        }
+        else if constexpr (Op == BitwiseOp::kOr)
+        {
+            _mm256_storeu_si256(d, _mm256_or_si256(a, b));
+        }
+        else
+        {
+            _mm256_storeu_si256(d, _mm256_xor_si256(a, b));
+        }
+    }
+    ApplyScalar<Op>(dst + i, src + i, n - i);
+}
+
+__attribute__((target("avx2"))) void
+NotAvx2(std::uint8_t* bytes, std::size_t n) noexcept
+{
+    __m256i const ones = _mm256_set1_epi8(-1);
+    std::size_t   i    = 0;
+    for (; i + 32 <= n; i += 32)
+    {
+        auto* const d = reinterpret_cast<__m256i*>(bytes + i);
+        _mm256_storeu_si256(d, _mm256_xor_si256(_mm256_loadu_si256(d), ones));
+    }
+    NotScalar(bytes + i, n - i);
+}
+
+/**
+ * Population count by nibble lookup with vpshufb, summed up with vpsadbw (see
+ * Mula, Kurz, Lemire: Faster Population Counts Using AVX2 Instructions).
+ */
+__attribute__((target("avx2"))) std::size_t
+PopCountAvx2(std::uint8_t const* bytes, std::size_t n) noexcept
+{
+    __m256i const lookup = _mm256_setr_epi8(0, 1, 1, 2, 1, 2, 2, 3,
+                                            1, 2, 2, 3, 2, 3, 3, 4,
+                                            0, 1, 1, 2, 1, 2, 2, 3,
+                                            1, 2, 2, 3, 2, 3, 3, 4);
+    __m256i const low    = _mm256_set1_epi8(0x0f);
+    __m256i       total  = _mm256_setzero_si256();
+    std::size_t   i      = 0;
+    for (; i + 32 <= n; i += 32)
+    {
+        __m256i const v =
+          _mm256_loadu_si256(reinterpret_cast<__m256i const*>(bytes + i));
+        __m256i const lo =
+          _mm256_shuffle_epi8(lookup, _mm256_and_si256(v, low));
+        __m256i const hi = _mm256_shuffle_epi8(
+          lookup, _mm256_and_si256(_mm256_srli_epi16(v, 4), low));
+        total = _mm256_add_epi64(
+          total,
+          _mm256_sad_epu8(_mm256_add_epi8(lo, hi), _mm256_setzero_si256()));
+    }
+    auto const count = static_cast<std::uint64_t>(
+      _mm256_extract_epi64(total, 0) + _mm256_extract_epi64(total, 1)
+      + _mm256_extract_epi64(total, 2) + _mm256_extract_epi64(total, 3));
+    return count + PopCountScalar(bytes + i, n - i);
+}
+#endif
+
+/**
+ * Kernels of the best instruction set supported by the CPU, selected once.
+ */
+struct Kernels
+{
+    BinaryKernel   andBytes;
+    BinaryKernel   orBytes;
+    BinaryKernel   xorBytes;
+    NotKernel      notBytes;
+    PopCountKernel popCount;
+};
+
+Kernels SelectKernels() noexcept
+{
+#ifdef ARA_CORE_BYTE_OPERATIONS_AVX2
+    if (__builtin_cpu_supports("avx2"))
+    {
+        return {ApplyAvx2<BitwiseOp::kAnd>,
+                ApplyAvx2<BitwiseOp::kOr>,
+                ApplyAvx2<BitwiseOp::kXor>,
+                NotAvx2,
+                PopCountAvx2};
+    }
+#endif
+    return {ApplyScalar<BitwiseOp::kAnd>,
+            ApplyScalar<BitwiseOp::kOr>,
+            ApplyScalar<BitwiseOp::kXor>,
+            NotScalar,
+            PopCountScalar};
+}
+
+Kernels const& ActiveKernels() noexcept
+{
+    static Kernels const kernels = SelectKernels();
+    return kernels;
+}
+
+std::uint8_t* Bytes(Span<Byte> s) noexcept
+{
+    return reinterpret_cast<std::uint8_t*>(s.data());
+}
+
+std::uint8_t const* Bytes(Span<Byte const> s) noexcept
+{
+    return reinterpret_cast<std::uint8_t const*>(s.data());
+}
+
+}  // namespace
+
+void AndBytes(Span<Byte> dst, Span<Byte const> src) noexcept
+{
+    ActiveKernels().andBytes(
+      Bytes(dst), Bytes(src), std::min(dst.size(), src.size()));
+}
+
+void OrBytes(Span<Byte> dst, Span<Byte const> src) noexcept
+{
+    ActiveKernels().orBytes(
+      Bytes(dst), Bytes(src), std::min(dst.size(), src.size()));
+}
+
+void XorBytes(Span<Byte> dst, Span<Byte const> src) noexcept
+{
+    ActiveKernels().xorBytes(
+      Bytes(dst), Bytes(src), std::min(dst.size(), src.size()));
+}
+
+void NotBytes(Span<Byte> bytes) noexcept
+{
+    ActiveKernels().notBytes(Bytes(bytes), bytes.size());
+}
+
+std::size_t PopCount(Span<Byte const> bytes) noexcept
+{
+    return ActiveKernels().popCount(Bytes(bytes), bytes.size());
+}
+
+}  // namespace ara::core
@@ -0,0 +1,223 @@
+#include "ara/core/checksum.h"
+
+#include <array>
+#include <bit>  // std::endian
+#include <cstddef>
+#include <cstring>  // std::memcpy
+
+#include "ara/core/endian.h"
+
+#if defined(__x86_64__) && defined(__GNUC__)
+#    define ARA_CORE_CHECKSUM_SSE42
+#    include <nmmintrin.h>
+#endif
+
+namespace ara::core::internal {
+
+namespace {
+
+template<typename T> using CrcTables = std::array<std::array<T, 256>, 8>;
+
+/**
+ * Build the slicing-by-8 tables of a CRC: tables[k][b] is the register after
+ * processing byte b followed by k zero bytes, starting from a zero register.
+ *
+ * @tparam Width number of bits of the CRC, 8 to 64.
+ * @tparam Reflected whether bits are processed least significant first; poly
+ * shall be bit-reversed then.
+ */
+template<typename T, std::size_t Width, bool Reflected>
+constexpr CrcTables<T> MakeCrcTables(std::uint64_t poly) noexcept
+{
+    constexpr std::uint64_t mask =
+      Width == 64 ? ~std::uint64_t{0} : (std::uint64_t{1} << Width) - 1;
+    constexpr std::uint64_t top = std::uint64_t{1} << (Width - 1);
+
+    CrcTables<T> tables{};
+    for (std::uint64_t b = 0; b < 256; ++b)
+    {
+        std::uint64_t crc = Reflected ? b : b << (Width - 8);
+        for (int bit = 0; bit < 8; ++bit)
+        {
+            if constexpr (Reflected)
+            {
+                crc = (crc & 1) != 0 ? (crc >> 1) ^ poly : crc >> 1;
+            }
+            else
+            {
+                crc = ((crc & top) != 0 ? (crc << 1) ^ poly : crc << 1) & mask;
+            }
+        }
+        tables[0][b] = static_cast<T>(crc);
+    }
+    for (std::size_t k = 1; k < 8; ++k)
+    {
+        for (std::size_t b = 0; b < 256; ++b)
+        {
+            std::uint64_t const crc = tables[k - 1][b];
+            if constexpr (Reflected)
+            {
+                tables[k][b] =
+                  static_cast<T>((crc >> 8) ^ tables[0][crc & 0xFF]);
+            }
+            else
+            {
+                tables[k][b] = static_cast<T>(
+                  ((crc << 8) & mask) ^ tables[0][(crc >> (Width - 8)) & 0xFF]);
+            }
+        }
+    }
+    return tables;
+}
+
+/**
+ * Slicing-by-8: fold 8 bytes into the register with 8 independent table
+ * lookups, then process the remaining bytes one at a time.
+ */
+template<typename T, std::size_t Width, bool Reflected> std::uint64_t
+UpdateSliced(CrcTables<T> const& t,
+             std::uint64_t       crc,
+             std::uint8_t const* p,
+             std::size_t         n) noexcept
+{
+    constexpr std::uint64_t mask =
+      Width == 64 ? ~std::uint64_t{0} : (std::uint64_t{1} << Width) - 1;
+
+    for (; n >= 8; n -= 8, p += 8)
+    {
+        std::uint64_t x;
+        std::memcpy(&x, p, 8);
+        if constexpr (Reflected)
+        {
+            x = ConvertByteOrder<std::endian::little>(x) ^ crc;
+            crc = t[7][x & 0xFF] ^ t[6][(x >> 8) & 0xFF]
+                  ^ t[5][(x >> 16) & 0xFF] ^ t[4][(x >> 24) & 0xFF]
+                  ^ t[3][(x >> 32) & 0xFF] ^ t[2][(x >> 40) & 0xFF]
+                  ^ t[1][(x >> 48) & 0xFF] ^ t[0][x >> 56];
+        }
+        else
+        {
+            x = ConvertByteOrder<std::endian::big>(x) ^ (crc << (64 - Width));
+            crc = t[7][x >> 56] ^ t[6][(x >> 48) & 0xFF]
+                  ^ t[5][(x >> 40) & 0xFF] ^ t[4][(x >> 32) & 0xFF]
+                  ^ t[3][(x >> 24) & 0xFF] ^ t[2][(x >> 16) & 0xFF]
+                  ^ t[1][(x >> 8) & 0xFF] ^ t[0][x & 0xFF];
+        }
+    }
+    for (; n > 0; --n, ++p)
+    {
+        if constexpr (Reflected)
+        {
+            crc = (crc >> 8) ^ t[0][(crc ^ *p) & 0xFF];
+        }
+        else
+        {
+            crc = ((crc << 8) & mask)
+                  ^ t[0][((crc >> (Width - 8)) ^ *p) & 0xFF];
+        }
+    }
+    return crc;
+}
+
+constexpr auto crc8SaeJ1850Tables =
+  MakeCrcTables<std::uint8_t, 8, false>(0x1D);
+constexpr auto crc16CcittFalseTables =
+  MakeCrcTables<std::uint16_t, 16, false>(0x1021);
+constexpr auto crc32Tables =
+  MakeCrcTables<std::uint32_t, 32, true>(0xEDB88320);
+constexpr auto crc32CTables =
+  MakeCrcTables<std::uint32_t, 32, true>(0x82F63B78);
+constexpr auto crc64XzTables =
+  MakeCrcTables<std::uint64_t, 64, true>(0xC96C5795D7870F42);
+
+std::uint8_t const* Bytes(Span<Byte const> data) noexcept
+{
+    return reinterpret_cast<std::uint8_t const*>(data.data());
+}
+
+using Crc32CKernel = std::uint32_t (*)(std::uint32_t,
+                                       std::uint8_t const*,
+                                       std::size_t) noexcept;
+
+std::uint32_t
+Crc32CSliced(std::uint32_t crc, std::uint8_t const* p, std::size_t n) noexcept
+{
+    return static_cast<std::uint32_t>(
+      UpdateSliced<std::uint32_t, 32, true>(crc32CTables, crc, p, n));
+}
+
+#ifdef ARA_CORE_CHECKSUM_SSE42
+/**
+ * CRC-32C with the CRC32 instruction of SSE 4.2, 8 bytes per instruction.
+ */
+__attribute__((target("sse4.2"))) std::uint32_t
+Crc32CSse42(std::uint32_t crc, std::uint8_t const* p, std::size_t n) noexcept
+{
+    std::uint64_t crc64 = crc;
+    for (; n >= 8; n -= 8, p += 8)
+    {
+        std::uint64_t x;
+        std::memcpy(&x, p, 8);
+        crc64 = _mm_crc32_u64(crc64, x);
+    }
+    auto crc32 = static_cast<std::uint32_t>(crc64);
+    for (; n > 0; --n, ++p) { crc32 = _mm_crc32_u8(crc32, *p); }
+    return crc32;
+}
+#endif
+
+Crc32CKernel SelectCrc32CKernel() noexcept
+{
+#ifdef ARA_CORE_CHECKSUM_SSE42
+    if (__builtin_cpu_supports("sse4.2"))
+    {
+        return Crc32CSse42;
+    }
+#endif
+    return Crc32CSliced;
+}
+
+}  // namespace
+
+Crc8SaeJ1850Traits::ValueType
+Crc8SaeJ1850Traits::Update(ValueType crc, Span<Byte const> data) noexcept
+{
+    return static_cast<ValueType>(UpdateSliced<std::uint8_t, 8, false>(
+      crc8SaeJ1850Tables, crc, Bytes(data), data.size()));
+}
+
+Crc16CcittFalseTraits::ValueType
+Crc16CcittFalseTraits::Update(ValueType crc, Span<Byte const> data) noexcept
+{
+    return static_cast<ValueType>(UpdateSliced<std::uint16_t, 16, false>(
+      crc16CcittFalseTables, crc, Bytes(data), data.size()));
+}
+
+Crc32Traits::ValueType
+Crc32Traits::Update(ValueType crc, Span<Byte const> data) noexcept
+{
+    return static_cast<ValueType>(UpdateSliced<std::uint32_t, 32, true>(
+      crc32Tables, crc, Bytes(data), data.size()));
+}
+
+Crc32CTraits::ValueType
+Crc32CTraits::Update(ValueType crc, Span<Byte const> data) noexcept
+{
+    static Crc32CKernel const kernel = SelectCrc32CKernel();
+    return kernel(crc, Bytes(data), data.size());
+}
+
+std::uint32_t Crc32CUpdateSliced(std::uint32_t crc,
+                                 Span<Byte const> data) noexcept
+{
+    return Crc32CSliced(crc, Bytes(data), data.size());
+}
+
+Crc64XzTraits::ValueType
+Crc64XzTraits::Update(ValueType crc, Span<Byte const> data) noexcept
+{
+    return UpdateSliced<std::uint64_t, 64, true>(
+      crc64XzTables, crc, Bytes(data), data.size());
+}
+
+}  // namespace ara::core::internal
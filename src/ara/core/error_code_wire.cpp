@@ -0,0 +1,112 @@
+#include "ara/core/error_code_wire.h"
+
+#include <bit>      // std::endian
+#include <cstdint>  // uint64_t
+#include <cstring>  // std::memcpy
+#include <type_traits>
+
+#include "ara/core/endian.h"
+#include "ara/core/error_domain_registry.h"
+
+namespace ara::core {
+
+namespace {
+
+static_assert(sizeof(ErrorDomain::IdType) == 8);
+static_assert(sizeof(ErrorDomain::CodeType) == 4);
+static_assert(sizeof(ErrorDomain::SupportDataType) == 4);
+static_assert(std::is_trivially_copyable_v<Byte> && sizeof(Byte) == 1);
+
+/**
+ * Layout of a record, written with a single copy on little endian hosts.
+ */
+struct Record
+{
+    std::uint64_t id;
+    std::uint32_t value;
+    std::uint32_t data;
+};
+
+static_assert(sizeof(Record) == kErrorCodeWireSize);
+
+inline Record ToLittleEndian(Record record) noexcept
+{
+    record.id    = ConvertByteOrder<std::endian::little>(record.id);
+    record.value = ConvertByteOrder<std::endian::little>(record.value);
+    record.data  = ConvertByteOrder<std::endian::little>(record.data);
+    return record;
+}
+
+inline void Store(ErrorCode const& code, Byte* out) noexcept
+{
+    Record const record =
+      ToLittleEndian({code.Domain().Id(),
+                      static_cast<std::uint32_t>(code.Value()),
+                      code.SupportData()});
+    std::memcpy(static_cast<void*>(out), &record, sizeof(record));
+}
+
+inline Record Load(Byte const* in) noexcept
+{
+    Record record;
+    std::memcpy(&record, static_cast<void const*>(in), sizeof(record));
+    return ToLittleEndian(record);
+}
+
+}  // namespace
+
+void EncodeErrorCode(ErrorCode const&               code,
+                     Span<Byte, kErrorCodeWireSize> out) noexcept
+{
+    Store(code, out.data());
+}
+
+std::optional<ErrorCode>
+DecodeErrorCode(Span<Byte const, kErrorCodeWireSize> in) noexcept
+{
+    Record const record = Load(in.data());
+    return ReconstructErrorCode(
+      record.id, static_cast<ErrorDomain::CodeType>(record.value), record.data);
+}
+
+std::size_t EncodeErrorCodes(Span<ErrorCode const> codes,
+                             Span<Byte>            out) noexcept
+{
+    Byte* cursor = out.data();
+    for (auto const& code : codes)
+    {
+        Store(code, cursor);
+        cursor += kErrorCodeWireSize;
+    }
+    return codes.size() * kErrorCodeWireSize;
+}
+
+std::size_t DecodeErrorCodes(Span<Byte const>               in,
+                             Span<std::optional<ErrorCode>> out) noexcept
+{
+    std::size_t const  count   = in.size() / kErrorCodeWireSize;
+    std::size_t        decoded = 0;
+    ErrorDomain const* domain  = nullptr;
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        Record const record = Load(in.data() + i * kErrorCodeWireSize);
+        // records of one stream mostly share a domain, skip the lookup then
+        if (domain == nullptr || domain->Id() != record.id)
+        {
+            domain = FindErrorDomain(record.id);
+        }
+        if (domain == nullptr)
+        {
+            out[i] = std::nullopt;
+            continue;
+        }
+        out[i] = internal::RestoreErrorCode(
+          static_cast<ErrorDomain::CodeType>(record.value),
+          *domain,
+          record.data);
+        ++decoded;
+    }
+    return decoded;
+}
+
+}  // namespace ara::core
@@ -0,0 +1,91 @@
+#include "ara/core/error_domain_registry.h"
+
+#include <atomic>
+
+#include "ara/core/core_error_domain.h"
+
+namespace ara::core {
+
+namespace {
+
+/**
+ * Open-addressing table with a load factor of at most 1/2. Slots are claimed
+ * once and never cleared, so lookups only need acquire loads. The table is
+ * constant-initialized, so it can be used during static initialization.
+ */
+constexpr std::size_t kSlots = 2 * kMaxRegisteredErrorDomains;
+
+std::atomic<ErrorDomain const*> slots[kSlots];
+std::atomic<std::size_t>        registered{0};
+
+static_assert((kSlots & (kSlots - 1)) == 0, "slot count must be power of 2");
+
+constexpr std::size_t SlotOf(ErrorDomain::IdType id) noexcept
+{
+    // Fibonacci hashing, domain Ids often differ in their low bits only
+    return ((id * 0x9e3779b97f4a7c15u) >> 32) & (kSlots - 1);
+}
+
+}  // namespace
+
+bool RegisterErrorDomain(ErrorDomain const& domain) noexcept
+{
+    if (FindErrorDomain(domain.Id()) != nullptr)
+    {
+        return true;
+    }
+    if (registered.fetch_add(1, std::memory_order_relaxed)
+        >= kMaxRegisteredErrorDomains)
+    {
+        registered.fetch_sub(1, std::memory_order_relaxed);
+        return false;
+    }
+
+    for (std::size_t i = SlotOf(domain.Id());; i = (i + 1) & (kSlots - 1))
+    {
+        ErrorDomain const* expected = nullptr;
+        if (slots[i].compare_exchange_strong(expected,
+                                             &domain,
+                                             std::memory_order_release,
+                                             std::memory_order_acquire))
+        {
+            return true;
+        }
+        if (*expected == domain)
+        {
+            // registered concurrently by another thread
+            registered.fetch_sub(1, std::memory_order_relaxed);
+            return true;
+        }
+    }
+}
+
+ErrorDomain const* FindErrorDomain(ErrorDomain::IdType id) noexcept
+{
+    if (id == GetCoreErrorDomain().Id())
+    {
+        return &GetCoreErrorDomain();
+    }
+    for (std::size_t i = SlotOf(id);; i = (i + 1) & (kSlots - 1))
+    {
+        auto const* domain = slots[i].load(std::memory_order_acquire);
+        if (domain == nullptr || domain->Id() == id)
+        {
+            return domain;
+        }
+    }
+}
+
+std::optional<ErrorCode>
+ReconstructErrorCode(ErrorDomain::IdType          domainId,
+                     ErrorDomain::CodeType        value,
+                     ErrorDomain::SupportDataType data) noexcept
+{
+    if (auto const* domain = FindErrorDomain(domainId))
+    {
+        return internal::RestoreErrorCode(value, *domain, data);
+    }
+    return std::nullopt;
+}
+
+}  // namespace ara::core
@@ -0,0 +1,277 @@
+#include "ara/core/error_statistics.h"
+
+#include <algorithm>
+#include <atomic>
+#include <new>  // std::nothrow
+#include <tuple>
+
+namespace ara::core {
+
+namespace {
+
+/**
+ * Open-addressing table of (domain, code) keys with a load factor of at most
+ * 1/2. Keys are claimed once and never cleared.
+ */
+constexpr std::size_t kSlots = 2 * kMaxTrackedErrorCodes;
+
+constexpr std::size_t kCacheLineSize = 64;
+
+static_assert((kSlots & (kSlots - 1)) == 0, "slot count must be power of 2");
+
+enum class KeyState : int
+{
+    kEmpty,
+    kClaiming,
+    kReady
+};
+
+struct Key
+{
+    std::atomic<KeyState> state;
+    /**
+     * Written once by the thread which claimed the slot, before state becomes
+     * kReady.
+     */
+    ErrorDomain::IdType   domain;
+    ErrorDomain::CodeType code;
+};
+
+/**
+ * Counters owned by a single thread, which is their only writer, so that
+ * counting is a plain increment and threads never write to the same cache
+ * line. Blocks are never freed: the block of a finished thread keeps its
+ * counts and is taken over by the next thread which needs one.
+ */
+struct alignas(kCacheLineSize) Block
+{
+    std::atomic<std::uint64_t> created[kSlots];
+    std::atomic<std::uint64_t> thrown[kSlots];
+    std::atomic<bool>          owned;
+    /**
+     * Written before the block is published in the list.
+     */
+    Block* next;
+};
+
+Key                      keys[kSlots];
+std::atomic<std::size_t> tracked{0};
+std::atomic<Block*>      blocks{nullptr};
+
+constexpr std::size_t
+SlotOf(ErrorDomain::IdType domain, ErrorDomain::CodeType code) noexcept
+{
+    auto const key = domain ^ static_cast<std::uint32_t>(code);
+    // Fibonacci hashing, codes of a domain are usually consecutive
+    return ((key * 0x9e3779b97f4a7c15u) >> 32) & (kSlots - 1);
+}
+
+/**
+ * Find the slot of the given error, claiming one if it was not seen before.
+ *
+ * @return std::size_t the slot, or kSlots if the table is full
+ */
+std::size_t
+FindOrClaimSlot(ErrorDomain::IdType domain, ErrorDomain::CodeType code) noexcept
+{
+    for (std::size_t i = SlotOf(domain, code);; i = (i + 1) & (kSlots - 1))
+    {
+        Key&     key   = keys[i];
+        KeyState state = key.state.load(std::memory_order_acquire);
+        if (state == KeyState::kEmpty)
+        {
+            if (tracked.fetch_add(1, std::memory_order_relaxed)
+                >= kMaxTrackedErrorCodes)
+            {
+                tracked.fetch_sub(1, std::memory_order_relaxed);
+                return kSlots;
+            }
+            if (key.state.compare_exchange_strong(state,
+                                                  KeyState::kClaiming,
+                                                  std::memory_order_acquire))
+            {
+                key.domain = domain;
+                key.code   = code;
+                key.state.store(KeyState::kReady, std::memory_order_release);
+                return i;
+            }
+            // claimed concurrently by another thread
+            tracked.fetch_sub(1, std::memory_order_relaxed);
+        }
+        while (state == KeyState::kClaiming)
+        {
+            state = key.state.load(std::memory_order_acquire);
+        }
+        if (key.domain == domain && key.code == code)
+        {
+            return i;
+        }
+    }
+}
+
+/**
+ * Take over a block of a finished thread, or allocate a new one.
+ *
+ * @return Block* the block, or nullptr if out of memory
+ */
+Block* AcquireBlock() noexcept
+{
+    for (Block* block = blocks.load(std::memory_order_acquire);
+         block != nullptr;
+         block = block->next)
+    {
+        bool owned = false;
+        if (block->owned.compare_exchange_strong(
+              owned, true, std::memory_order_acquire))
+        {
+            return block;
+        }
+    }
+    Block* const block = new (std::nothrow) Block{};
+    if (block != nullptr)
+    {
+        block->owned.store(true, std::memory_order_relaxed);
+        block->next = blocks.load(std::memory_order_relaxed);
+        while (! blocks.compare_exchange_weak(block->next,
+                                              block,
+                                              std::memory_order_release,
+                                              std::memory_order_relaxed))
+        {}
+    }
+    return block;
+}
+
+/**
+ * Block of the calling thread, released when the thread exits.
+ */
+class BlockOwner final
+{
+ public:
+    BlockOwner() noexcept : block{AcquireBlock()} {}
+
+    ~BlockOwner()
+    {
+        if (block != nullptr)
+        {
+            block->owned.store(false, std::memory_order_release);
+        }
+    }
+
+    BlockOwner(BlockOwner const&) = delete;
+    BlockOwner& operator=(BlockOwner const&) = delete;
+
+    Block* Get() const noexcept { return block; }
+
+ private:
+    Block* block;
+};
+
+/**
+ * Increment a counter of the block of the calling thread; as the thread is its
+ * only writer, no read-modify-write operation is needed.
+ */
+void Increment(std::atomic<std::uint64_t>& counter) noexcept
+{
+    counter.store(counter.load(std::memory_order_relaxed) + 1,
+                  std::memory_order_relaxed);
+}
+
+Block* ThreadBlock() noexcept
+{
+    thread_local BlockOwner const owner;
+    return owner.Get();
+}
+
+}  // namespace
+
+namespace internal {
+
+void RecordErrorCreated(ErrorDomain::IdType   domain,
+                        ErrorDomain::CodeType code) noexcept
+{
+    std::size_t const slot  = FindOrClaimSlot(domain, code);
+    Block* const      block = ThreadBlock();
+    if (slot != kSlots && block != nullptr)
+    {
+        Increment(block->created[slot]);
+    }
+}
+
+void RecordErrorThrown(ErrorDomain::IdType   domain,
+                       ErrorDomain::CodeType code) noexcept
+{
+    std::size_t const slot  = FindOrClaimSlot(domain, code);
+    Block* const      block = ThreadBlock();
+    if (slot != kSlots && block != nullptr)
+    {
+        Increment(block->thrown[slot]);
+    }
+}
+
+}  // namespace internal
+
+ErrorStatisticsSnapshot TakeErrorStatisticsSnapshot()
+{
+    ErrorStatisticsSnapshot snapshot{std::chrono::steady_clock::now(), {}};
+    Block* const            first = blocks.load(std::memory_order_acquire);
+    for (std::size_t i = 0; i < kSlots; ++i)
+    {
+        if (keys[i].state.load(std::memory_order_acquire) != KeyState::kReady)
+        {
+            continue;
+        }
+        ErrorStatisticsEntry entry{keys[i].domain, keys[i].code, 0, 0};
+        for (Block const* block = first; block != nullptr; block = block->next)
+        {
+            entry.created += block->created[i].load(std::memory_order_relaxed);
+            entry.thrown += block->thrown[i].load(std::memory_order_relaxed);
+        }
+        snapshot.entries.push_back(entry);
+    }
+    std::sort(snapshot.entries.begin(),
+              snapshot.entries.end(),
+              [](ErrorStatisticsEntry const& a, ErrorStatisticsEntry const& b) {
+                  return std::tie(a.domain, a.code)
+                         < std::tie(b.domain, b.code);
+              });
+    return snapshot;
+}
+
+std::vector<ErrorRate> ErrorRates(ErrorStatisticsSnapshot const& earlier,
+                                  ErrorStatisticsSnapshot const& later)
+{
+    std::chrono::duration<double> const elapsed = later.time - earlier.time;
+
+    std::vector<ErrorRate> rates;
+    rates.reserve(later.entries.size());
+    // both entry lists are sorted, and earlier holds a subset of the errors
+    auto previous = earlier.entries.begin();
+    for (ErrorStatisticsEntry const& entry : later.entries)
+    {
+        while (previous != earlier.entries.end()
+               && std::tie(previous->domain, previous->code)
+                    < std::tie(entry.domain, entry.code))
+        {
+            ++previous;
+        }
+        std::uint64_t created = entry.created;
+        std::uint64_t thrown  = entry.thrown;
+        if (previous != earlier.entries.end()
+            && previous->domain == entry.domain && previous->code == entry.code)
+        {
+            created -= previous->created;
+            thrown -= previous->thrown;
+        }
+
+        ErrorRate rate{entry.domain, entry.code, 0.0, 0.0};
+        if (elapsed.count() > 0.0)
+        {
+            rate.created = static_cast<double>(created) / elapsed.count();
+            rate.thrown  = static_cast<double>(thrown) / elapsed.count();
+        }
+        rates.push_back(rate);
+    }
+    return rates;
+}
+
+}  // namespace ara::core
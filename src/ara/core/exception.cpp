@@ -1,8 +1,41 @@
 #include "ara/core/exception.h"
 
+#ifdef ARA_CORE_ENABLE_EXCEPTION_BACKTRACE
+#    include <algorithm>
+#    include <execinfo.h>
+#endif
+
+#ifdef ARA_CORE_ENABLE_ERROR_STATISTICS
+#    include "ara/core/error_statistics.h"
+#endif
+
 namespace ara::core {
 
-Exception::Exception(ErrorCode const& err) noexcept : error{err} {}
+#ifdef ARA_CORE_ENABLE_EXCEPTION_BACKTRACE
+namespace {
+// glibc loads libgcc_s on the first backtrace() call, which allocates; do that
+// during static initialization instead of in the first thrown exception, which
+// may be thrown while out of memory
+[[maybe_unused]] int const backtraceWarmUp = [] {
+    void* frame;
+    return ::backtrace(&frame, 1);
+}();
+}  // namespace
+#endif
+
+Exception::Exception(ErrorCode const& err) noexcept : error{err}
+{
+#ifdef ARA_CORE_ENABLE_ERROR_STATISTICS
+    internal::RecordErrorThrown(err.Domain().Id(), err.Value());
+#endif
+#ifdef ARA_CORE_ENABLE_EXCEPTION_BACKTRACE
+    // one more frame than stored, as the frame of this constructor is skipped
+    void*     frames[kMaxStackTraceFrames + 1];
+    int const count = ::backtrace(frames, kMaxStackTraceFrames + 1);
+    stackTraceSize  = count > 1 ? static_cast<std::size_t>(count - 1) : 0;
+    std::copy(frames + 1, frames + 1 + stackTraceSize, stackTrace);
+#endif
+}
 
 const char* Exception::what() const noexcept
 {
@@ -13,4 +46,21 @@ ErrorCode const& Exception::Error() const noexcept
 {
     return error;
 }
+
+Span<void* const> Exception::StackTrace() const noexcept
+{
+#ifdef ARA_CORE_ENABLE_EXCEPTION_BACKTRACE
+    return {stackTrace, stackTraceSize};
+#else
+    return {};
+#endif
+}
+
+void Exception::WriteStackTrace([[maybe_unused]] int fd) const noexcept
+{
+#ifdef ARA_CORE_ENABLE_EXCEPTION_BACKTRACE
+    ::backtrace_symbols_fd(
+      stackTrace, static_cast<int>(stackTraceSize), fd);
+#endif
+}
 }  // namespace ara::core
@@ -0,0 +1,74 @@
+#include "ara/core/metamodel_validation.h"
+
+#if defined(__SSE2__)
+#    include <emmintrin.h>
+#endif
+
+namespace ara::core {
+
+namespace internal {
+
+#if defined(__SSE2__)
+namespace {
+
+/**
+ * Mark all bytes of v within the unsigned range [lo, hi] with 0xFF.
+ */
+inline __m128i InRange(__m128i v, char lo, char hi) noexcept
+{
+    __m128i const zero = _mm_setzero_si128();
+    __m128i const geLo = _mm_cmpeq_epi8(_mm_subs_epu8(_mm_set1_epi8(lo), v),
+                                        zero);
+    __m128i const leHi = _mm_cmpeq_epi8(_mm_subs_epu8(v, _mm_set1_epi8(hi)),
+                                        zero);
+    return _mm_and_si128(geLo, leHi);
+}
+
+}  // namespace
+#endif
+
+std::size_t FindInvalidPathChar(char const* s, std::size_t n) noexcept
+{
+    std::size_t i = 0;
+#if defined(__SSE2__)
+    // classify 16 characters at once: [A-Za-z] (case folded), [0-9], '_', '/'
+    for (; i + 16 <= n; i += 16)
+    {
+        __m128i const v =
+          _mm_loadu_si128(reinterpret_cast<__m128i const*>(s + i));
+        __m128i const folded = _mm_or_si128(v, _mm_set1_epi8(0x20));
+        __m128i       valid  = _mm_or_si128(InRange(folded, 'a', 'z'),
+                                     InRange(v, '0', '9'));
+        valid = _mm_or_si128(valid, _mm_cmpeq_epi8(v, _mm_set1_epi8('_')));
+        valid = _mm_or_si128(valid, _mm_cmpeq_epi8(v, _mm_set1_epi8('/')));
+
+        auto const invalid =
+          ~static_cast<unsigned>(_mm_movemask_epi8(valid)) & 0xFFFFu;
+        if (invalid != 0)
+        {
+            return i + static_cast<std::size_t>(__builtin_ctz(invalid));
+        }
+    }
+#endif
+    return i + FindInvalidPathCharScalar(s + i, n - i);
+}
+
+}  // namespace internal
+
+std::size_t
+ValidateMetaModelPaths(Span<StringView const>         paths,
+                       Span<std::optional<ErrorCode>> results) noexcept
+{
+    std::size_t invalid = 0;
+    for (std::size_t i = 0; i < paths.size(); ++i)
+    {
+        results[i] = ValidateMetaModelPath(paths[i]);
+        if (results[i])
+        {
+            ++invalid;
+        }
+    }
+    return invalid;
+}
+
+}  // namespace ara::core
@@ -0,0 +1,465 @@
+#include "ara/core/shared_memory.h"
+
+#include <fcntl.h>
+#include <pthread.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <algorithm>  // std::max, std::swap
+#include <atomic>
+#include <cerrno>
+#include <cstdint>
+#include <string>
+
+namespace ara::core {
+
+namespace internal {
+
+namespace {
+
+constexpr std::uint64_t kMagic     = 0x41524153484D454D;  // "ARASHMEM"
+constexpr std::size_t   kAlignment = alignof(std::max_align_t);
+
+/**
+ * Precedes every block of the segment, free or allocated. Free blocks form a
+ * list ordered by offset, so that neighbours can be merged on release.
+ */
+struct alignas(kAlignment) Block
+{
+    /**
+     * Size including this header, a multiple of kAlignment.
+     */
+    std::uint64_t size;
+    /**
+     * Offset of the next free block from the segment header, 0 for none;
+     * unused while allocated.
+     */
+    std::uint64_t next;
+};
+
+/**
+ * Smallest remainder split off a free block, room for a header and some
+ * data.
+ */
+constexpr std::size_t kMinBlockSize = 2 * sizeof(Block);
+
+constexpr std::size_t RoundUp(std::size_t size) noexcept
+{
+    return (size + kAlignment - 1) & ~(kAlignment - 1);
+}
+
+static_assert(std::atomic<std::uint64_t>::is_always_lock_free,
+              "segment synchronization must be address-free");
+
+/**
+ * Keep the stores around it in program order, so that a process killed
+ * between them leaves the free list valid.
+ */
+void CrashOrder() noexcept
+{
+    std::atomic_signal_fence(std::memory_order_seq_cst);
+}
+
+}  // namespace
+
+struct SegmentHeader
+{
+    /**
+     * kMagic, stored last when the segment is initialized.
+     */
+    std::atomic<std::uint64_t> magic;
+    std::uint64_t              size;
+    /**
+     * Robust process-shared mutex of the free list, so that a process which
+     * dies holding it does not block the others.
+     */
+    pthread_mutex_t            lock;
+    std::uint64_t              freeList;
+    std::uint64_t              freeSize;
+    /**
+     * Offset of the object set by SetRoot(), 0 for none.
+     */
+    std::atomic<std::uint64_t> root;
+};
+
+namespace {
+
+constexpr std::size_t kFirstBlock = RoundUp(sizeof(SegmentHeader));
+
+std::uint8_t* Base(SegmentHeader& header) noexcept
+{
+    return reinterpret_cast<std::uint8_t*>(&header);
+}
+
+Block& At(SegmentHeader& header, std::uint64_t offset) noexcept
+{
+    return *reinterpret_cast<Block*>(Base(header) + offset);
+}
+
+class LockGuard final
+{
+ public:
+    explicit LockGuard(SegmentHeader& header) noexcept : header_{header}
+    {
+        if (::pthread_mutex_lock(&header_.lock) == EOWNERDEAD)
+        {
+            // the free list is valid at every step of an update, but
+            // freeSize and the blocks being moved may be lost
+            header_.freeSize = 0;
+            for (std::uint64_t offset = header_.freeList; offset != 0;)
+            {
+                Block const& block = At(header_, offset);
+                header_.freeSize += block.size;
+                offset = block.next;
+            }
+            ::pthread_mutex_consistent(&header_.lock);
+        }
+    }
+
+    LockGuard(LockGuard const&) = delete;
+    LockGuard& operator=(LockGuard const&) = delete;
+
+    ~LockGuard() { ::pthread_mutex_unlock(&header_.lock); }
+
+ private:
+    SegmentHeader& header_;
+};
+
+}  // namespace
+
+void* SegmentAllocate(SegmentHeader& header, std::size_t size) noexcept
+{
+    if (size > header.size)
+    {
+        return nullptr;
+    }
+    std::uint64_t const needed =
+      std::max(RoundUp(size + sizeof(Block)), kMinBlockSize);
+
+    LockGuard const guard{header};
+    std::uint64_t*  link = &header.freeList;
+    while (*link != 0)
+    {
+        std::uint64_t const offset = *link;
+        Block&              block  = At(header, offset);
+        if (block.size >= needed)
+        {
+            if (block.size - needed >= kMinBlockSize)
+            {
+                // the rest is lost if killed before it is linked
+                Block& rest = At(header, offset + needed);
+                rest.size   = block.size - needed;
+                rest.next   = block.next;
+                CrashOrder();
+                block.size = needed;
+                CrashOrder();
+                *link = offset + needed;
+            }
+            else
+            {
+                *link = block.next;
+            }
+            header.freeSize -= block.size;
+            return &block + 1;
+        }
+        link = &block.next;
+    }
+    return nullptr;
+}
+
+void SegmentDeallocate(SegmentHeader& header, void* address) noexcept
+{
+    if (address == nullptr)
+    {
+        return;
+    }
+    std::uint64_t const offset = static_cast<std::uint64_t>(
+      reinterpret_cast<std::uint8_t*>(static_cast<Block*>(address) - 1)
+      - Base(header));
+
+    LockGuard const     guard{header};
+    Block&              block = At(header, offset);
+    std::uint64_t const size  = block.size;
+
+    std::uint64_t  previous = 0;
+    std::uint64_t* link     = &header.freeList;
+    while (*link != 0 && *link < offset)
+    {
+        previous = *link;
+        link     = &At(header, previous).next;
+    }
+
+    // merge with the following free block while the block is not linked yet,
+    // then link it with a single store, so a process killed in between at
+    // most loses blocks
+    block.next = *link;
+    if (block.next != 0 && offset + block.size == block.next)
+    {
+        Block const& next = At(header, block.next);
+        block.size += next.size;
+        block.next = next.next;
+    }
+    CrashOrder();
+    if (previous != 0 && previous + At(header, previous).size == offset)
+    {
+        Block& before = At(header, previous);
+        before.next   = block.next;
+        CrashOrder();
+        before.size += block.size;
+    }
+    else
+    {
+        *link = offset;
+    }
+    header.freeSize += size;
+}
+
+}  // namespace internal
+
+namespace {
+
+/**
+ * Close fd and keep errno of the failure which caused it.
+ */
+void CloseAfterError(int fd) noexcept
+{
+    int const error = errno;
+    ::close(fd);
+    errno = error;
+}
+
+}  // namespace
+
+SharedMemorySegment::SharedMemorySegment(internal::SegmentHeader* header,
+                                         std::size_t              size,
+                                         int                      fd) noexcept
+    : header_{header}, size_{size}, fd_{fd}
+{}
+
+SharedMemorySegment::SharedMemorySegment(SharedMemorySegment&& other) noexcept
+    : header_{other.header_}, size_{other.size_}, fd_{other.fd_}
+{
+    other.header_ = nullptr;
+    other.fd_     = -1;
+}
+
+SharedMemorySegment&
+SharedMemorySegment::operator=(SharedMemorySegment&& other) noexcept
+{
+    // other unmaps the previous segment of this one
+    std::swap(header_, other.header_);
+    std::swap(size_, other.size_);
+    std::swap(fd_, other.fd_);
+    return *this;
+}
+
+SharedMemorySegment::~SharedMemorySegment()
+{
+    if (header_ != nullptr)
+    {
+        ::munmap(header_, size_);
+    }
+    if (fd_ >= 0)
+    {
+        ::close(fd_);
+    }
+}
+
+std::optional<SharedMemorySegment>
+SharedMemorySegment::Map(int         fd,
+                         std::size_t size,
+                         void*       address,
+                         bool        initialize)
+{
+    if (size < internal::kFirstBlock + internal::kMinBlockSize)
+    {
+        ::close(fd);
+        errno = EINVAL;
+        return std::nullopt;
+    }
+
+    int flags = MAP_SHARED;
+#ifdef MAP_FIXED_NOREPLACE
+    if (address != nullptr)
+    {
+        flags |= MAP_FIXED_NOREPLACE;
+    }
+#endif
+    void* const mapping =
+      ::mmap(address, size, PROT_READ | PROT_WRITE, flags, fd, 0);
+    if (mapping == MAP_FAILED)
+    {
+        CloseAfterError(fd);
+        return std::nullopt;
+    }
+    if (address != nullptr && mapping != address)
+    {
+        // kernels without MAP_FIXED_NOREPLACE take the address as a hint
+        ::munmap(mapping, size);
+        ::close(fd);
+        errno = EEXIST;
+        return std::nullopt;
+    }
+
+    auto* const header = static_cast<internal::SegmentHeader*>(mapping);
+    if (initialize)
+    {
+        pthread_mutexattr_t attributes;
+        ::pthread_mutexattr_init(&attributes);
+        ::pthread_mutexattr_setpshared(&attributes, PTHREAD_PROCESS_SHARED);
+        ::pthread_mutexattr_setrobust(&attributes, PTHREAD_MUTEX_ROBUST);
+        int const error = ::pthread_mutex_init(&header->lock, &attributes);
+        ::pthread_mutexattr_destroy(&attributes);
+        if (error != 0)
+        {
+            ::munmap(mapping, size);
+            ::close(fd);
+            errno = error;
+            return std::nullopt;
+        }
+
+        std::uint64_t const first = internal::kFirstBlock;
+        header->size              = size;
+        header->freeList          = first;
+        header->freeSize = (size - first) & ~(internal::kAlignment - 1);
+        header->root.store(0, std::memory_order_relaxed);
+        internal::Block& block = internal::At(*header, first);
+        block.size             = header->freeSize;
+        block.next             = 0;
+        header->magic.store(internal::kMagic, std::memory_order_release);
+    }
+    else if (header->magic.load(std::memory_order_acquire) != internal::kMagic
+             || header->size != size)
+    {
+        ::munmap(mapping, size);
+        ::close(fd);
+        errno = EINVAL;
+        return std::nullopt;
+    }
+    return SharedMemorySegment{header, size, fd};
+}
+
+std::optional<SharedMemorySegment>
+SharedMemorySegment::Create(StringView name, std::size_t size, void* address)
+{
+    std::string const path{name};
+    int const         fd =
+      ::shm_open(path.c_str(), O_RDWR | O_CREAT | O_EXCL | O_CLOEXEC, 0600);
+    if (fd < 0)
+    {
+        return std::nullopt;
+    }
+    std::optional<SharedMemorySegment> segment;
+    if (::ftruncate(fd, static_cast<off_t>(size)) != 0)
+    {
+        CloseAfterError(fd);
+    }
+    else
+    {
+        segment = Map(fd, size, address, true);
+    }
+    if (! segment)
+    {
+        int const error = errno;
+        ::shm_unlink(path.c_str());
+        errno = error;
+    }
+    return segment;
+}
+
+std::optional<SharedMemorySegment>
+SharedMemorySegment::Open(StringView name, void* address)
+{
+    std::string const path{name};
+    int const         fd = ::shm_open(path.c_str(), O_RDWR | O_CLOEXEC, 0);
+    if (fd < 0)
+    {
+        return std::nullopt;
+    }
+    struct stat status;
+    if (::fstat(fd, &status) != 0)
+    {
+        CloseAfterError(fd);
+        return std::nullopt;
+    }
+    return Map(fd, static_cast<std::size_t>(status.st_size), address, false);
+}
+
+bool SharedMemorySegment::Remove(StringView name) noexcept
+{
+    try
+    {
+        std::string const path{name};
+        return ::shm_unlink(path.c_str()) == 0;
+    }
+    catch (std::bad_alloc const&)
+    {
+        errno = ENOMEM;
+        return false;
+    }
+}
+
+std::optional<SharedMemorySegment>
+SharedMemorySegment::CreateAnonymous(std::size_t size)
+{
+#ifdef __linux__
+    int const fd = ::memfd_create("ara-core-segment", MFD_CLOEXEC);
+    if (fd < 0)
+    {
+        return std::nullopt;
+    }
+    if (::ftruncate(fd, static_cast<off_t>(size)) != 0)
+    {
+        CloseAfterError(fd);
+        return std::nullopt;
+    }
+    return Map(fd, size, nullptr, true);
+#else
+    static_cast<void>(size);
+    errno = ENOSYS;
+    return std::nullopt;
+#endif
+}
+
+std::optional<SharedMemorySegment>
+SharedMemorySegment::FromFileDescriptor(int fd, void* address)
+{
+    int const duplicate = ::fcntl(fd, F_DUPFD_CLOEXEC, 0);
+    if (duplicate < 0)
+    {
+        return std::nullopt;
+    }
+    struct stat status;
+    if (::fstat(duplicate, &status) != 0)
+    {
+        CloseAfterError(duplicate);
+        return std::nullopt;
+    }
+    return Map(
+      duplicate, static_cast<std::size_t>(status.st_size), address, false);
+}
+
+std::size_t SharedMemorySegment::FreeSize() const noexcept
+{
+    internal::LockGuard const guard{*header_};
+    return header_->freeSize;
+}
+
+void SharedMemorySegment::SetRoot(void const* object) noexcept
+{
+    std::uint64_t const offset =
+      object == nullptr
+        ? 0
+        : static_cast<std::uint64_t>(static_cast<std::uint8_t const*>(object)
+                                     - internal::Base(*header_));
+    header_->root.store(offset, std::memory_order_release);
+}
+
+void* SharedMemorySegment::RootAddress() const noexcept
+{
+    std::uint64_t const offset = header_->root.load(std::memory_order_acquire);
+    return offset == 0 ? nullptr : internal::Base(*header_) + offset;
+}
+
+}  // namespace ara::core
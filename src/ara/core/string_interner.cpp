@@ -0,0 +1,172 @@
+#include "ara/core/string_interner.h"
+
+#include <algorithm>  // std::max
+#include <cstring>    // std::memcpy
+#include <new>
+
+#include "ara/core/internal/hash.h"
+
+namespace ara::core {
+
+using internal::InternedEntry;
+
+namespace {
+
+constexpr std::size_t kPageSize        = 64 * 1024;
+constexpr std::size_t kInitialCapacity = 1024;
+
+thread_local StringInterner::Statistics threadStatistics{0, 0};
+
+constexpr std::size_t AlignUp(std::size_t n, std::size_t alignment) noexcept
+{
+    return (n + alignment - 1) & ~(alignment - 1);
+}
+
+}  // namespace
+
+/**
+ * Open-addressing hash table with linear probing. Slots are only ever filled,
+ * never cleared, so readers can probe without synchronization beyond the
+ * acquire load of each slot.
+ */
+struct StringInterner::Table
+{
+    explicit Table(std::size_t capacity)
+      : mask{capacity - 1}
+      , slots{new std::atomic<InternedEntry const*>[capacity]()}
+    {}
+
+    void Place(InternedEntry const* entry, std::memory_order order) noexcept
+    {
+        std::size_t i = entry->hash & mask;
+        while (slots[i].load(std::memory_order_relaxed) != nullptr)
+        {
+            i = (i + 1) & mask;
+        }
+        slots[i].store(entry, order);
+    }
+
+    std::size_t                                              mask;
+    std::unique_ptr<std::atomic<InternedEntry const*>[]> slots;
+};
+
+StringInterner& StringInterner::Global() noexcept
+{
+    static StringInterner interner;
+    return interner;
+}
+
+StringInterner::Statistics StringInterner::ThreadStatistics() noexcept
+{
+    return threadStatistics;
+}
+
+void StringInterner::ResetThreadStatistics() noexcept
+{
+    threadStatistics = Statistics{0, 0};
+}
+
+StringInterner::StringInterner()
+  : table{nullptr}, pageUsed{0}, pageCapacity{0}, size{0}
+{
+    tables.push_back(std::make_unique<Table>(kInitialCapacity));
+    table.store(tables.back().get(), std::memory_order_release);
+}
+
+StringInterner::~StringInterner() = default;
+
+InternedString StringInterner::Intern(StringView s)
+{
+    std::uint64_t const hash = internal::Fnv1a(s);
+    if (auto const* entry = Lookup(hash, s))
+    {
+        ++threadStatistics.hits;
+        return InternedString{entry};
+    }
+
+    std::lock_guard<std::mutex> lock{mutex};
+    // another thread may have added s since the lock-free lookup
+    if (auto const* entry = Lookup(hash, s))
+    {
+        ++threadStatistics.hits;
+        return InternedString{entry};
+    }
+    ++threadStatistics.misses;
+    auto const* entry = Allocate(hash, s);
+    Insert(entry);
+    return InternedString{entry};
+}
+
+InternedString StringInterner::Find(StringView s) const noexcept
+{
+    auto const* entry = Lookup(internal::Fnv1a(s), s);
+    // Find() never inserts, so a failed lookup is not a miss
+    if (entry != nullptr) { ++threadStatistics.hits; }
+    return InternedString{entry};
+}
+
+std::size_t StringInterner::Size() const noexcept
+{
+    return size.load(std::memory_order_relaxed);
+}
+
+InternedEntry const*
+StringInterner::Lookup(std::uint64_t hash, StringView s) const noexcept
+{
+    Table const* t = table.load(std::memory_order_acquire);
+    for (std::size_t i = hash & t->mask;; i = (i + 1) & t->mask)
+    {
+        auto const* entry = t->slots[i].load(std::memory_order_acquire);
+        if (entry == nullptr)
+        {
+            return nullptr;
+        }
+        if (entry->hash == hash && entry->view == s)
+        {
+            return entry;
+        }
+    }
+}
+
+InternedEntry const* StringInterner::Allocate(std::uint64_t hash, StringView s)
+{
+    std::size_t const bytes =
+      AlignUp(sizeof(InternedEntry) + s.size() + 1, alignof(InternedEntry));
+    if (pageUsed + bytes > pageCapacity)
+    {
+        pageCapacity = std::max(kPageSize, bytes);
+        pageUsed     = 0;
+        pages.emplace_back(new char[pageCapacity]);
+    }
+    char* const memory = pages.back().get() + pageUsed;
+    pageUsed += bytes;
+
+    char* const chars = memory + sizeof(InternedEntry);
+    std::memcpy(chars, s.data(), s.size());
+    chars[s.size()] = '\0';
+    return new (memory) InternedEntry{hash, StringView{chars, s.size()}};
+}
+
+void StringInterner::Insert(InternedEntry const* entry)
+{
+    Table* t = table.load(std::memory_order_relaxed);
+    // keep the load factor at or below 1/2
+    if ((size.load(std::memory_order_relaxed) + 1) * 2 > t->mask + 1)
+    {
+        auto grown = std::make_unique<Table>((t->mask + 1) * 2);
+        for (std::size_t i = 0; i <= t->mask; ++i)
+        {
+            if (auto const* e = t->slots[i].load(std::memory_order_relaxed))
+            {
+                grown->Place(e, std::memory_order_relaxed);
+            }
+        }
+        t = grown.get();
+        tables.push_back(std::move(grown));
+        table.store(t, std::memory_order_release);
+    }
+    t->Place(entry, std::memory_order_release);
+    size.fetch_add(1, std::memory_order_relaxed);
+}
+
+}  // namespace ara::core
@@ -0,0 +1,654 @@
+#include "ara/core/text_encoding.h"
+
+#include <array>
+#include <cstdint>
+
+#include "ara/core/core_error_domain.h"
+
+#if defined(__x86_64__) && defined(__GNUC__)
+#    define ARA_CORE_TEXT_ENCODING_SIMD
+#    include <immintrin.h>
+#endif
+
+namespace ara::core {
+
+namespace {
+
+constexpr char kLowerDigits[] = "0123456789abcdef";
+constexpr char kUpperDigits[] = "0123456789ABCDEF";
+constexpr char kBase64Alphabet[] =
+  "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+
+constexpr std::uint8_t kInvalid = 0xFF;
+
+using DecodeTable = std::array<std::uint8_t, 256>;
+
+constexpr DecodeTable MakeDecodeTable(char const* digits,
+                                      std::size_t count) noexcept
+{
+    DecodeTable table{};
+    for (auto& value : table) { value = kInvalid; }
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        table[static_cast<std::uint8_t>(digits[i])] =
+          static_cast<std::uint8_t>(i);
+    }
+    return table;
+}
+
+constexpr DecodeTable MakeHexTable() noexcept
+{
+    DecodeTable table = MakeDecodeTable(kLowerDigits, 16);
+    for (std::size_t i = 10; i < 16; ++i)
+    {
+        table[static_cast<std::uint8_t>(kUpperDigits[i])] =
+          static_cast<std::uint8_t>(i);
+    }
+    return table;
+}
+
+constexpr DecodeTable hexValues    = MakeHexTable();
+constexpr DecodeTable base64Values = MakeDecodeTable(kBase64Alphabet, 64);
+
+std::uint8_t HexValue(char c) noexcept
+{
+    return hexValues[static_cast<std::uint8_t>(c)];
+}
+
+std::uint8_t Base64Value(char c) noexcept
+{
+    return base64Values[static_cast<std::uint8_t>(c)];
+}
+
+/**
+ * Portable kernels, processing one byte or one base64 quantum at a time.
+ */
+void EncodeHexScalar(std::uint8_t const* in,
+                     std::size_t         n,
+                     char*               out,
+                     char const*         digits) noexcept
+{
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        out[2 * i]     = digits[in[i] >> 4];
+        out[2 * i + 1] = digits[in[i] & 0x0F];
+    }
+}
+
+std::size_t
+DecodeHexScalar(char const* in, std::size_t n, std::uint8_t* out) noexcept
+{
+    for (std::size_t i = 0; i < n; i += 2)
+    {
+        std::uint8_t const high = HexValue(in[i]);
+        std::uint8_t const low  = HexValue(in[i + 1]);
+        if (high == kInvalid)
+        {
+            return i;
+        }
+        if (low == kInvalid)
+        {
+            return i + 1;
+        }
+        out[i / 2] = static_cast<std::uint8_t>(high << 4 | low);
+    }
+    return n;
+}
+
+void EncodeBase64Scalar(std::uint8_t const* in,
+                        std::size_t         n,
+                        char*               out) noexcept
+{
+    for (std::size_t i = 0; i < n; i += 3, out += 4)
+    {
+        std::uint32_t const triple = std::uint32_t{in[i]} << 16
+                                     | std::uint32_t{in[i + 1]} << 8
+                                     | in[i + 2];
+        out[0] = kBase64Alphabet[triple >> 18];
+        out[1] = kBase64Alphabet[(triple >> 12) & 0x3F];
+        out[2] = kBase64Alphabet[(triple >> 6) & 0x3F];
+        out[3] = kBase64Alphabet[triple & 0x3F];
+    }
+}
+
+std::size_t
+DecodeBase64Scalar(char const* in, std::size_t n, std::uint8_t* out) noexcept
+{
+    for (std::size_t i = 0; i < n; i += 4, out += 3)
+    {
+        std::uint32_t triple = 0;
+        for (std::size_t k = 0; k < 4; ++k)
+        {
+            std::uint8_t const value = Base64Value(in[i + k]);
+            if (value == kInvalid)
+            {
+                return i + k;
+            }
+            triple = triple << 6 | value;
+        }
+        out[0] = static_cast<std::uint8_t>(triple >> 16);
+        out[1] = static_cast<std::uint8_t>(triple >> 8);
+        out[2] = static_cast<std::uint8_t>(triple);
+    }
+    return n;
+}
+
+#ifdef ARA_CORE_TEXT_ENCODING_SIMD
+/**
+ * SSSE3 and AVX2 kernels, processing 16 or 32 bytes per iteration; blocks
+ * with invalid characters and the remainder are handled by the portable
+ * kernels, which also locate the error. The base64 kernels follow Mula,
+ * Lemire: Faster Base64 Encoding and Decoding Using AVX2 Instructions.
+ */
+__attribute__((target("ssse3"))) void
+EncodeHexSsse3(std::uint8_t const* in,
+               std::size_t         n,
+               char*               out,
+               char const*         digits) noexcept
+{
+    __m128i const lut =
+      _mm_loadu_si128(reinterpret_cast<__m128i const*>(digits));
+    __m128i const low = _mm_set1_epi8(0x0F);
+    std::size_t   i   = 0;
+    for (; i + 16 <= n; i += 16)
+    {
+        __m128i const v =
+          _mm_loadu_si128(reinterpret_cast<__m128i const*>(in + i));
+        __m128i const hi =
+          _mm_shuffle_epi8(lut, _mm_and_si128(_mm_srli_epi16(v, 4), low));
+        __m128i const lo = _mm_shuffle_epi8(lut, _mm_and_si128(v, low));
+        auto* const   d  = reinterpret_cast<__m128i*>(out + 2 * i);
+        _mm_storeu_si128(d, _mm_unpacklo_epi8(hi, lo));
+        _mm_storeu_si128(d + 1, _mm_unpackhi_epi8(hi, lo));
+    }
+    EncodeHexScalar(in + i, n - i, out + 2 * i, digits);
+}
+
+/**
+ * Convert hexadecimal digits to their values, flagging valid digits in valid.
+ */
+__attribute__((target("ssse3"))) __m128i
+HexNibblesSsse3(__m128i c, __m128i& valid) noexcept
+{
+    __m128i const digit =
+      _mm_and_si128(_mm_cmpgt_epi8(c, _mm_set1_epi8('0' - 1)),
+                    _mm_cmplt_epi8(c, _mm_set1_epi8('9' + 1)));
+    __m128i const lower = _mm_or_si128(c, _mm_set1_epi8(0x20));
+    __m128i const alpha =
+      _mm_and_si128(_mm_cmpgt_epi8(lower, _mm_set1_epi8('a' - 1)),
+                    _mm_cmplt_epi8(lower, _mm_set1_epi8('f' + 1)));
+    valid = _mm_or_si128(digit, alpha);
+    return _mm_or_si128(
+      _mm_and_si128(digit, _mm_sub_epi8(c, _mm_set1_epi8('0'))),
+      _mm_and_si128(alpha, _mm_sub_epi8(lower, _mm_set1_epi8('a' - 10))));
+}
+
+__attribute__((target("ssse3"))) std::size_t
+DecodeHexSsse3(char const* in, std::size_t n, std::uint8_t* out) noexcept
+{
+    // multiply the high nibble by 16 and add the low one
+    __m128i const weights = _mm_set1_epi16(0x0110);
+    std::size_t   i       = 0;
+    for (; i + 32 <= n; i += 32)
+    {
+        __m128i valid0;
+        __m128i valid1;
+        __m128i const v0 = HexNibblesSsse3(
+          _mm_loadu_si128(reinterpret_cast<__m128i const*>(in + i)), valid0);
+        __m128i const v1 = HexNibblesSsse3(
+          _mm_loadu_si128(reinterpret_cast<__m128i const*>(in + i + 16)),
+          valid1);
+        if (_mm_movemask_epi8(_mm_and_si128(valid0, valid1)) != 0xFFFF)
+        {
+            break;
+        }
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(out + i / 2),
+                         _mm_packus_epi16(_mm_maddubs_epi16(v0, weights),
+                                          _mm_maddubs_epi16(v1, weights)));
+    }
+    return i + DecodeHexScalar(in + i, n - i, out + i / 2);
+}
+
+/**
+ * Split 12 bytes (at offset 0 of each 128 bit lane) into 16 indices of 6 bits
+ * and translate them into the base64 alphabet.
+ */
+__attribute__((target("ssse3"))) __m128i
+Base64CharsSsse3(__m128i bytes) noexcept
+{
+    __m128i const in = _mm_shuffle_epi8(
+      bytes, _mm_set_epi8(10, 11, 9, 10, 7, 8, 6, 7, 4, 5, 3, 4, 1, 2, 0, 1));
+    __m128i const t0 = _mm_and_si128(in, _mm_set1_epi32(0x0FC0FC00));
+    __m128i const t1 = _mm_mulhi_epu16(t0, _mm_set1_epi32(0x04000040));
+    __m128i const t2 = _mm_and_si128(in, _mm_set1_epi32(0x003F03F0));
+    __m128i const t3 = _mm_mullo_epi16(t2, _mm_set1_epi32(0x01000010));
+    __m128i const indices = _mm_or_si128(t1, t3);
+
+    __m128i result = _mm_subs_epu8(indices, _mm_set1_epi8(51));
+    __m128i const less = _mm_cmpgt_epi8(_mm_set1_epi8(26), indices);
+    result = _mm_or_si128(result, _mm_and_si128(less, _mm_set1_epi8(13)));
+    __m128i const offsets = _mm_setr_epi8('a' - 26, '0' - 52, '0' - 52,
+                                          '0' - 52, '0' - 52, '0' - 52,
+                                          '0' - 52, '0' - 52, '0' - 52,
+                                          '0' - 52, '0' - 52, '+' - 62,
+                                          '/' - 63, 'A', 0, 0);
+    return _mm_add_epi8(_mm_shuffle_epi8(offsets, result), indices);
+}
+
+__attribute__((target("ssse3"))) void
+EncodeBase64Ssse3(std::uint8_t const* in, std::size_t n, char* out) noexcept
+{
+    std::size_t i = 0;
+    for (; i + 16 <= n; i += 12)
+    {
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(out + i / 3 * 4),
+                         Base64CharsSsse3(_mm_loadu_si128(
+                           reinterpret_cast<__m128i const*>(in + i))));
+    }
+    EncodeBase64Scalar(in + i, n - i, out + i / 3 * 4);
+}
+
+/**
+ * Translate 16 base64 characters into their 6 bit values and pack those into
+ * 12 bytes, at offset 0 of the result; valid is cleared on invalid input.
+ */
+__attribute__((target("ssse3"))) __m128i
+Base64BytesSsse3(__m128i chars, bool& valid) noexcept
+{
+    __m128i const lutLo = _mm_setr_epi8(0x15, 0x11, 0x11, 0x11, 0x11, 0x11,
+                                        0x11, 0x11, 0x11, 0x11, 0x13, 0x1A,
+                                        0x1B, 0x1B, 0x1B, 0x1A);
+    __m128i const lutHi = _mm_setr_epi8(0x10, 0x10, 0x01, 0x02, 0x04, 0x08,
+                                        0x04, 0x08, 0x10, 0x10, 0x10, 0x10,
+                                        0x10, 0x10, 0x10, 0x10);
+    __m128i const lutRoll = _mm_setr_epi8(
+      0, 16, 19, 4, -65, -65, -71, -71, 0, 0, 0, 0, 0, 0, 0, 0);
+    __m128i const mask = _mm_set1_epi8(0x2F);
+
+    __m128i const hiNibbles = _mm_and_si128(_mm_srli_epi32(chars, 4), mask);
+    __m128i const lo = _mm_shuffle_epi8(lutLo, _mm_and_si128(chars, mask));
+    __m128i const hi = _mm_shuffle_epi8(lutHi, hiNibbles);
+    __m128i const invalid = _mm_and_si128(lo, hi);
+    valid = _mm_movemask_epi8(_mm_cmpeq_epi8(invalid, _mm_setzero_si128()))
+            == 0xFFFF;
+    __m128i const roll = _mm_shuffle_epi8(
+      lutRoll, _mm_add_epi8(_mm_cmpeq_epi8(chars, mask), hiNibbles));
+    __m128i const values = _mm_add_epi8(chars, roll);
+
+    __m128i const merged =
+      _mm_maddubs_epi16(values, _mm_set1_epi32(0x01400140));
+    __m128i const packed = _mm_madd_epi16(merged, _mm_set1_epi32(0x00011000));
+    return _mm_shuffle_epi8(
+      packed,
+      _mm_setr_epi8(2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1));
+}
+
+__attribute__((target("ssse3"))) std::size_t
+DecodeBase64Ssse3(char const* in, std::size_t n, std::uint8_t* out) noexcept
+{
+    // each iteration stores 16 bytes, of which the last 4 are overwritten by
+    // the next one
+    std::size_t i = 0;
+    for (; i + 24 <= n; i += 16)
+    {
+        bool          valid;
+        __m128i const bytes = Base64BytesSsse3(
+          _mm_loadu_si128(reinterpret_cast<__m128i const*>(in + i)), valid);
+        if (! valid)
+        {
+            break;
+        }
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(out + i / 4 * 3), bytes);
+    }
+    return i + DecodeBase64Scalar(in + i, n - i, out + i / 4 * 3);
+}
+
+__attribute__((target("avx2"))) void
+EncodeHexAvx2(std::uint8_t const* in,
+              std::size_t         n,
+              char*               out,
+              char const*         digits) noexcept
+{
+    __m256i const lut = _mm256_broadcastsi128_si256(
+      _mm_loadu_si128(reinterpret_cast<__m128i const*>(digits)));
+    __m256i const low = _mm256_set1_epi8(0x0F);
+    std::size_t   i   = 0;
+    for (; i + 32 <= n; i += 32)
+    {
+        __m256i const v =
+          _mm256_loadu_si256(reinterpret_cast<__m256i const*>(in + i));
+        __m256i const hi = _mm256_shuffle_epi8(
+          lut, _mm256_and_si256(_mm256_srli_epi16(v, 4), low));
+        __m256i const lo = _mm256_shuffle_epi8(lut, _mm256_and_si256(v, low));
+        // the unpacks work within 128 bit lanes, so the halves are swapped
+        __m256i const a = _mm256_unpacklo_epi8(hi, lo);
+        __m256i const b = _mm256_unpackhi_epi8(hi, lo);
+        auto* const   d = reinterpret_cast<__m256i*>(out + 2 * i);
+        _mm256_storeu_si256(d, _mm256_permute2x128_si256(a, b, 0x20));
+        _mm256_storeu_si256(d + 1, _mm256_permute2x128_si256(a, b, 0x31));
+    }
+    EncodeHexSsse3(in + i, n - i, out + 2 * i, digits);
+}
+
+__attribute__((target("avx2"))) __m256i
+HexNibblesAvx2(__m256i c, __m256i& valid) noexcept
+{
+    __m256i const digit =
+      _mm256_and_si256(_mm256_cmpgt_epi8(c, _mm256_set1_epi8('0' - 1)),
+                       _mm256_cmpgt_epi8(_mm256_set1_epi8('9' + 1), c));
+    __m256i const lower = _mm256_or_si256(c, _mm256_set1_epi8(0x20));
+    __m256i const alpha =
+      _mm256_and_si256(_mm256_cmpgt_epi8(lower, _mm256_set1_epi8('a' - 1)),
+                       _mm256_cmpgt_epi8(_mm256_set1_epi8('f' + 1), lower));
+    valid = _mm256_or_si256(digit, alpha);
+    return _mm256_or_si256(
+      _mm256_and_si256(digit, _mm256_sub_epi8(c, _mm256_set1_epi8('0'))),
+      _mm256_and_si256(alpha,
+                       _mm256_sub_epi8(lower, _mm256_set1_epi8('a' - 10))));
+}
+
+__attribute__((target("avx2"))) std::size_t
+DecodeHexAvx2(char const* in, std::size_t n, std::uint8_t* out) noexcept
+{
+    __m256i const weights = _mm256_set1_epi16(0x0110);
+    std::size_t   i       = 0;
+    for (; i + 64 <= n; i += 64)
+    {
+        __m256i       valid0;
+        __m256i       valid1;
+        __m256i const v0 = HexNibblesAvx2(
+          _mm256_loadu_si256(reinterpret_cast<__m256i const*>(in + i)),
+          valid0);
+        __m256i const v1 = HexNibblesAvx2(
+          _mm256_loadu_si256(reinterpret_cast<__m256i const*>(in + i + 32)),
+          valid1);
+        if (_mm256_movemask_epi8(_mm256_and_si256(valid0, valid1)) != -1)
+        {
+            break;
+        }
+        // the pack works within 128 bit lanes, so the quarters are reordered
+        __m256i const packed =
+          _mm256_packus_epi16(_mm256_maddubs_epi16(v0, weights),
+                              _mm256_maddubs_epi16(v1, weights));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i / 2),
+                            _mm256_permute4x64_epi64(packed, 0xD8));
+    }
+    return i + DecodeHexSsse3(in + i, n - i, out + i / 2);
+}
+
+__attribute__((target("avx2"))) void
+EncodeBase64Avx2(std::uint8_t const* in, std::size_t n, char* out) noexcept
+{
+    __m256i const shuffle = _mm256_setr_epi8(1, 0, 2, 1, 4, 3, 5, 4,
+                                             7, 6, 8, 7, 10, 9, 11, 10,
+                                             1, 0, 2, 1, 4, 3, 5, 4,
+                                             7, 6, 8, 7, 10, 9, 11, 10);
+    __m256i const offsets = _mm256_setr_epi8(
+      'a' - 26, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52,
+      '0' - 52, '0' - 52, '0' - 52, '0' - 52, '+' - 62, '/' - 63, 'A', 0, 0,
+      'a' - 26, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52,
+      '0' - 52, '0' - 52, '0' - 52, '0' - 52, '+' - 62, '/' - 63, 'A', 0, 0);
+    std::size_t i = 0;
+    for (; i + 28 <= n; i += 24)
+    {
+        // 12 bytes into each 128 bit lane
+        __m256i const bytes = _mm256_inserti128_si256(
+          _mm256_castsi128_si256(
+            _mm_loadu_si128(reinterpret_cast<__m128i const*>(in + i))),
+          _mm_loadu_si128(reinterpret_cast<__m128i const*>(in + i + 12)),
+          1);
+        __m256i const v  = _mm256_shuffle_epi8(bytes, shuffle);
+        __m256i const t0 = _mm256_and_si256(v, _mm256_set1_epi32(0x0FC0FC00));
+        __m256i const t1 =
+          _mm256_mulhi_epu16(t0, _mm256_set1_epi32(0x04000040));
+        __m256i const t2 = _mm256_and_si256(v, _mm256_set1_epi32(0x003F03F0));
+        __m256i const t3 =
+          _mm256_mullo_epi16(t2, _mm256_set1_epi32(0x01000010));
+        __m256i const indices = _mm256_or_si256(t1, t3);
+
+        __m256i result = _mm256_subs_epu8(indices, _mm256_set1_epi8(51));
+        __m256i const less =
+          _mm256_cmpgt_epi8(_mm256_set1_epi8(26), indices);
+        result = _mm256_or_si256(
+          result, _mm256_and_si256(less, _mm256_set1_epi8(13)));
+        _mm256_storeu_si256(
+          reinterpret_cast<__m256i*>(out + i / 3 * 4),
+          _mm256_add_epi8(_mm256_shuffle_epi8(offsets, result), indices));
+    }
+    EncodeBase64Ssse3(in + i, n - i, out + i / 3 * 4);
+}
+
+__attribute__((target("avx2"))) std::size_t
+DecodeBase64Avx2(char const* in, std::size_t n, std::uint8_t* out) noexcept
+{
+    __m256i const lutLo = _mm256_setr_epi8(
+      0x15, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x13, 0x1A,
+      0x1B, 0x1B, 0x1B, 0x1A, 0x15, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+      0x11, 0x11, 0x13, 0x1A, 0x1B, 0x1B, 0x1B, 0x1A);
+    __m256i const lutHi = _mm256_setr_epi8(
+      0x10, 0x10, 0x01, 0x02, 0x04, 0x08, 0x04, 0x08, 0x10, 0x10, 0x10, 0x10,
+      0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x01, 0x02, 0x04, 0x08, 0x04, 0x08,
+      0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10);
+    __m256i const lutRoll = _mm256_setr_epi8(
+      0, 16, 19, 4, -65, -65, -71, -71, 0, 0, 0, 0, 0, 0, 0, 0,
+      0, 16, 19, 4, -65, -65, -71, -71, 0, 0, 0, 0, 0, 0, 0, 0);
+    __m256i const pack = _mm256_setr_epi8(
+      2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1,
+      2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1);
+    __m256i const mask = _mm256_set1_epi8(0x2F);
+
+    // each iteration stores 32 bytes, of which the last 8 are overwritten by
+    // the next one
+    std::size_t i = 0;
+    for (; i + 44 <= n; i += 32)
+    {
+        __m256i const chars =
+          _mm256_loadu_si256(reinterpret_cast<__m256i const*>(in + i));
+        __m256i const hiNibbles =
+          _mm256_and_si256(_mm256_srli_epi32(chars, 4), mask);
+        __m256i const lo =
+          _mm256_shuffle_epi8(lutLo, _mm256_and_si256(chars, mask));
+        __m256i const hi = _mm256_shuffle_epi8(lutHi, hiNibbles);
+        if (! _mm256_testz_si256(lo, hi))
+        {
+            break;
+        }
+        __m256i const roll = _mm256_shuffle_epi8(
+          lutRoll,
+          _mm256_add_epi8(_mm256_cmpeq_epi8(chars, mask), hiNibbles));
+        __m256i const values = _mm256_add_epi8(chars, roll);
+        __m256i const merged =
+          _mm256_maddubs_epi16(values, _mm256_set1_epi32(0x01400140));
+        __m256i const packed = _mm256_shuffle_epi8(
+          _mm256_madd_epi16(merged, _mm256_set1_epi32(0x00011000)), pack);
+        // move the 12 bytes of the upper lane next to those of the lower one
+        _mm256_storeu_si256(
+          reinterpret_cast<__m256i*>(out + i / 4 * 3),
+          _mm256_permutevar8x32_epi32(
+            packed, _mm256_setr_epi32(0, 1, 2, 4, 5, 6, 7, 7)));
+    }
+    return i + DecodeBase64Ssse3(in + i, n - i, out + i / 4 * 3);
+}
+#endif
+
+/**
+ * Kernels of all instruction sets, in the order of preference; the AVX2
+ * kernels process their remainder with the SSSE3 ones.
+ */
+constexpr internal::TextEncodingKernels allKernels[] = {
+  {"scalar",
+   EncodeHexScalar,
+   DecodeHexScalar,
+   EncodeBase64Scalar,
+   DecodeBase64Scalar},
+#ifdef ARA_CORE_TEXT_ENCODING_SIMD
+  {"ssse3",
+   EncodeHexSsse3,
+   DecodeHexSsse3,
+   EncodeBase64Ssse3,
+   DecodeBase64Ssse3},
+  {"avx2", EncodeHexAvx2, DecodeHexAvx2, EncodeBase64Avx2, DecodeBase64Avx2},
+#endif
+};
+
+std::size_t CountSupportedKernels() noexcept
+{
+#ifdef ARA_CORE_TEXT_ENCODING_SIMD
+    if (! __builtin_cpu_supports("ssse3"))
+    {
+        return 1;
+    }
+    return __builtin_cpu_supports("avx2") ? 3 : 2;
+#else
+    return 1;
+#endif
+}
+
+/**
+ * Kernels of the best instruction set supported by the CPU, selected once.
+ */
+internal::TextEncodingKernels const& ActiveKernels() noexcept
+{
+    return internal::SupportedTextEncodingKernels().back();
+}
+
+std::uint8_t* Bytes(Span<Byte> s) noexcept
+{
+    return reinterpret_cast<std::uint8_t*>(s.data());
+}
+
+std::uint8_t const* Bytes(Span<Byte const> s) noexcept
+{
+    return reinterpret_cast<std::uint8_t const*>(s.data());
+}
+
+ErrorCode InvalidArgument(std::size_t supportData) noexcept
+{
+    return MakeErrorCode(
+      CoreErrc::kInvalidArgument,
+      static_cast<ErrorDomain::SupportDataType>(supportData));
+}
+
+}  // namespace
+
+namespace internal {
+
+Span<TextEncodingKernels const> SupportedTextEncodingKernels() noexcept
+{
+    static std::size_t const count = CountSupportedKernels();
+    return {allKernels, count};
+}
+
+}  // namespace internal
+
+std::optional<ErrorCode>
+EncodeHex(Span<Byte const> in, Span<char> out, HexCase letterCase) noexcept
+{
+    if (out.size() < HexEncodedSize(in.size()))
+    {
+        return InvalidArgument(HexEncodedSize(in.size()));
+    }
+    ActiveKernels().encodeHex(Bytes(in),
+                              in.size(),
+                              out.data(),
+                              letterCase == HexCase::kUpper ? kUpperDigits
+                                                            : kLowerDigits);
+    return std::nullopt;
+}
+
+std::optional<ErrorCode> DecodeHex(StringView in, Span<Byte> out) noexcept
+{
+    if (in.size() % 2 != 0)
+    {
+        return InvalidArgument(in.size());
+    }
+    if (out.size() < in.size() / 2)
+    {
+        return InvalidArgument(in.size() / 2);
+    }
+    std::size_t const end =
+      ActiveKernels().decodeHex(in.data(), in.size(), Bytes(out));
+    if (end != in.size())
+    {
+        return InvalidArgument(end);
+    }
+    return std::nullopt;
+}
+
+std::optional<ErrorCode> EncodeBase64(Span<Byte const> in,
+                                      Span<char>       out) noexcept
+{
+    if (out.size() < Base64EncodedSize(in.size()))
+    {
+        return InvalidArgument(Base64EncodedSize(in.size()));
+    }
+    std::size_t const full = in.size() / 3 * 3;
+    ActiveKernels().encodeBase64(Bytes(in), full, out.data());
+
+    std::size_t const rest = in.size() - full;
+    if (rest > 0)
+    {
+        auto const    b0 = to_integer<std::uint8_t>(in[full]);
+        auto const    b1 = rest == 2 ? to_integer<std::uint8_t>(in[full + 1])
+                                     : std::uint8_t{0};
+        char* const   q  = out.data() + full / 3 * 4;
+        q[0]             = kBase64Alphabet[b0 >> 2];
+        q[1]             = kBase64Alphabet[(b0 & 0x03) << 4 | b1 >> 4];
+        q[2] = rest == 2 ? kBase64Alphabet[(b1 & 0x0F) << 2] : '=';
+        q[3] = '=';
+    }
+    return std::nullopt;
+}
+
+std::optional<ErrorCode> DecodeBase64(StringView in, Span<Byte> out) noexcept
+{
+    if (in.size() % 4 != 0)
+    {
+        return InvalidArgument(in.size());
+    }
+    if (out.size() < Base64DecodedSize(in))
+    {
+        return InvalidArgument(Base64DecodedSize(in));
+    }
+    if (in.empty())
+    {
+        return std::nullopt;
+    }
+
+    // the last quantum is decoded separately if it has padding
+    std::size_t const padding = in[in.size() - 1] != '=' ? 0
+                                : in[in.size() - 2] != '=' ? 1
+                                                           : 2;
+    std::size_t const full = padding == 0 ? in.size() : in.size() - 4;
+    std::size_t const end =
+      ActiveKernels().decodeBase64(in.data(), full, Bytes(out));
+    if (end != full)
+    {
+        return InvalidArgument(end);
+    }
+    if (padding == 0)
+    {
+        return std::nullopt;
+    }
+
+    char const* const q = in.data() + full;
+    std::uint8_t      values[3];
+    for (std::size_t k = 0; k < 4 - padding; ++k)
+    {
+        values[k] = Base64Value(q[k]);
+        if (values[k] == kInvalid)
+        {
+            return InvalidArgument(full + k);
+        }
+    }
+    std::size_t const o = full / 4 * 3;
+    out[o] = Byte{static_cast<std::uint8_t>(values[0] << 2 | values[1] >> 4)};
+    if (padding == 1)
+    {
+        out[o + 1] =
+          Byte{static_cast<std::uint8_t>(values[1] << 4 | values[2] >> 2)};
+    }
+    return std::nullopt;
+}
+
+}  // namespace ara::core
@@ -0,0 +1,190 @@
+#include "ara/core/varint.h"
+
+#include <algorithm>  // std::min
+#include <bit>        // std::countr_zero, std::endian
+#include <cstring>    // std::memcpy
+
+#include "ara/core/endian.h"
+
+#if defined(__SSE2__)
+#    define ARA_CORE_VARINT_SSE2
+#    include <emmintrin.h>
+#endif
+
+namespace ara::core {
+
+namespace {
+
+constexpr std::uint64_t kHighBits = 0x8080808080808080;
+
+std::uint64_t LoadWord(std::uint8_t const* p) noexcept
+{
+    std::uint64_t word;
+    std::memcpy(&word, p, 8);
+    return ConvertByteOrder<std::endian::little>(word);
+}
+
+/**
+ * Gather the continuation bits of 16 bytes: bit i is the most significant bit
+ * of byte i.
+ */
+std::uint32_t ContinuationMask(std::uint8_t const* p) noexcept
+{
+#ifdef ARA_CORE_VARINT_SSE2
+    return static_cast<std::uint32_t>(_mm_movemask_epi8(
+      _mm_loadu_si128(reinterpret_cast<__m128i const*>(p))));
+#else
+    // multiplying the isolated high bits by this constant moves the bit of
+    // byte i to bit 56 + i
+    constexpr std::uint64_t gather = 0x0102040810204080;
+    auto const low  = ((LoadWord(p) & kHighBits) >> 7) * gather;
+    auto const high = ((LoadWord(p + 8) & kHighBits) >> 7) * gather;
+    return static_cast<std::uint32_t>((low >> 56) | ((high >> 56) << 8));
+#endif
+}
+
+/**
+ * Remove the continuation bits of up to 8 groups of 7 bits, yielding their
+ * 56 bit concatenation: adjacent groups are merged pairwise in three steps.
+ */
+constexpr std::uint64_t Compact(std::uint64_t word) noexcept
+{
+    word &= 0x7F7F7F7F7F7F7F7F;
+    word = ((word & 0x7F007F007F007F00) >> 1) | (word & 0x007F007F007F007F);
+    word = ((word & 0x3FFF00003FFF0000) >> 2) | (word & 0x00003FFF00003FFF);
+    word = ((word & 0x0FFFFFFF00000000) >> 4) | (word & 0x000000000FFFFFFF);
+    return word;
+}
+
+static_assert(Compact(0x0000000000000000) == 0);
+static_assert(Compact(0x000000000000027F) == 0x17F);
+static_assert(Compact(0x7FFFFFFFFFFFFFFF) == 0x00FFFFFFFFFFFFFF);
+
+template<typename T> std::size_t
+EncodeAll(Span<T const> values, Span<Byte> out) noexcept
+{
+    std::size_t size = 0;
+    for (T const value : values)
+    {
+        if (value < 0x80)
+        {
+            out[size++] = Byte{static_cast<std::uint8_t>(value)};
+        }
+        else
+        {
+            size += EncodeVarint(value, out.subspan(size));
+        }
+    }
+    return size;
+}
+
+template<typename T> VarintDecodeResult
+DecodeAll(Span<Byte const> in, Span<T> out) noexcept
+{
+    auto const* const p = reinterpret_cast<std::uint8_t const*>(in.data());
+    std::size_t const n = in.size();
+    std::size_t       pos   = 0;
+    std::size_t       count = 0;
+
+    while (count < out.size() && n - pos >= 16)
+    {
+        std::uint32_t const mask = ContinuationMask(p + pos);
+        if (mask == 0)
+        {
+            // 16 single byte varints
+            std::size_t const block =
+              std::min<std::size_t>(16, out.size() - count);
+            for (std::size_t i = 0; i < block; ++i)
+            {
+                out[count + i] = p[pos + i];
+            }
+            pos += block;
+            count += block;
+            continue;
+        }
+
+        // decode the varints which end in this block; each one of up to 8
+        // bytes is a masked 64 bit load
+        std::uint32_t stops    = ~mask & 0xFFFF;
+        std::size_t   consumed = 0;
+        while (count < out.size() && stops != 0 && n - pos - consumed >= 8)
+        {
+            auto const length =
+              static_cast<std::size_t>(std::countr_zero(stops)) + 1 - consumed;
+            if (length > std::min<std::size_t>(8, kMaxVarintSize<T>))
+            {
+                break;
+            }
+            std::uint64_t const word =
+              LoadWord(p + pos + consumed)
+              & (~std::uint64_t{0} >> (64 - 8 * length));
+            std::uint64_t const value = Compact(word);
+            if constexpr (kMaxVarintSize<T> <= 8)
+            {
+                if (length == kMaxVarintSize<T>
+                    && (value >> (sizeof(T) * 8)) != 0)
+                {
+                    return {count, pos + consumed};
+                }
+            }
+            out[count++] = static_cast<T>(value);
+            consumed += length;
+            stops &= stops - 1;
+        }
+        if (consumed == 0)
+        {
+            // a varint longer than 8 bytes, or too close to the end of the
+            // input for a 64 bit load
+            T                 value;
+            std::size_t const length = DecodeVarint(in.subspan(pos), value);
+            if (length == 0)
+            {
+                return {count, pos};
+            }
+            out[count++] = value;
+            consumed     = length;
+        }
+        pos += consumed;
+    }
+
+    while (count < out.size() && pos < n)
+    {
+        T                 value;
+        std::size_t const length = DecodeVarint(in.subspan(pos), value);
+        if (length == 0)
+        {
+            break;
+        }
+        out[count++] = value;
+        pos += length;
+    }
+    return {count, pos};
+}
+
+}  // namespace
+
+std::size_t EncodeVarints(Span<std::uint32_t const> values,
+                          Span<Byte>                out) noexcept
+{
+    return EncodeAll(values, out);
+}
+
+std::size_t EncodeVarints(Span<std::uint64_t const> values,
+                          Span<Byte>                out) noexcept
+{
+    return EncodeAll(values, out);
+}
+
+VarintDecodeResult DecodeVarints(Span<Byte const>    in,
+                                 Span<std::uint32_t> out) noexcept
+{
+    return DecodeAll(in, out);
+}
+
+VarintDecodeResult DecodeVarints(Span<Byte const>    in,
+                                 Span<std::uint64_t> out) noexcept
+{
+    return DecodeAll(in, out);
+}
+
+}  // namespace ara::core
@@ -0,0 +1,79 @@
+#include <catch2/catch.hpp>
+
+#include <cstdint>
+
+#include "ara/core/array_algorithms.h"
+
+namespace core = ara::core;
+
+TEST_CASE("AlignedArray aligns its elements", "[SWS_CORE]")
+{
+    core::AlignedArray<float, 3>     array{1.0f, 2.0f, 3.0f};
+    core::AlignedArray<char, 1, 128> wide{'a'};
+
+    CHECK(alignof(decltype(array)) == core::kArrayAlignment);
+    CHECK(reinterpret_cast<std::uintptr_t>(array.data())
+            % core::kArrayAlignment
+          == 0);
+    CHECK(reinterpret_cast<std::uintptr_t>(wide.data()) % 128 == 0);
+    CHECK(array[2] == 3.0f);
+    CHECK(array == core::Array<float, 3>{1.0f, 2.0f, 3.0f});
+}
+
+TEST_CASE("Element-wise array operations", "[SWS_CORE]")
+{
+    core::Array<int, 5> const a{1, 2, 3, 4, 5};
+    core::Array<int, 5> const b{5, 4, 3, 2, 1};
+
+    CHECK(core::Add(a, b) == core::Array<int, 5>{6, 6, 6, 6, 6});
+    CHECK(core::Subtract(a, b) == core::Array<int, 5>{-4, -2, 0, 2, 4});
+    CHECK(core::Multiply(a, b) == core::Array<int, 5>{5, 8, 9, 8, 5});
+    CHECK(core::Scale(a, 3) == core::Array<int, 5>{3, 6, 9, 12, 15});
+
+    core::AlignedArray<std::uint8_t, 2> const c{std::uint8_t{200},
+                                                std::uint8_t{100}};
+    core::AlignedArray<std::uint8_t, 2> const sum = core::Add(c, c);
+    CHECK(sum[0] == 144);
+    CHECK(sum[1] == 200);
+}
+
+TEST_CASE("Array reductions", "[SWS_CORE]")
+{
+    core::AlignedArray<float, 19> a;
+    for (std::size_t i = 0; i < a.size(); ++i)
+    {
+        a[i] = static_cast<float>(i % 7) - 2.5f;
+    }
+
+    float sum = 0.0f;
+    float dot = 0.0f;
+    for (float x : a)
+    {
+        sum += x;
+        dot += x * x;
+    }
+
+    CHECK(core::Sum(a) == Approx(sum));
+    CHECK(core::Dot(a, a) == Approx(dot));
+    CHECK(core::Min(a) == -2.5f);
+    CHECK(core::Max(a) == 3.5f);
+
+    core::Array<int, 1> const single{-7};
+    CHECK(core::Sum(single) == -7);
+    CHECK(core::Min(single) == -7);
+    CHECK(core::Max(single) == -7);
+    CHECK(core::Sum(core::Array<int, 0>{}) == 0);
+}
+
+TEST_CASE("Array algorithms are usable in constant expressions", "[SWS_CORE]")
+{
+    constexpr core::Array<int, 4>        a{1, -2, 3, 4};
+    constexpr core::AlignedArray<int, 4> b{2, 2, 2, 2};
+
+    static_assert(core::Sum(a) == 6);
+    static_assert(core::Min(a) == -2);
+    static_assert(core::Max(a) == 4);
+    static_assert(core::Dot(a, a) == 30);
+    static_assert(core::Add(b, b)[3] == 4);
+    static_assert(core::Scale(a, 2) == core::Array<int, 4>{2, -4, 6, 8});
+}
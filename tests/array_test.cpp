@@ -1,5 +1,9 @@
 #include <catch2/catch.hpp>
 
+#include <string>
+#include <type_traits>
+#include <utility>
+
 #include "ara/core/array.h"
 
 TEST_CASE("Array can be constructed", "[SWS_CORE], [SWS_CORE_01201]")
@@ -122,6 +126,38 @@ TEST_CASE("get<N>", "[SWS_CORE], [SWS_CORE_01201]")
 {
     ara::core::Array<int, 3> a{0, 1, 2};
     CHECK(ara::core::get<1>(a) == 1);
+
+    ara::core::get<2>(a) = 5;
+    CHECK(a[2] == 5);
+
+    constexpr ara::core::Array<int, 2> b{3, 4};
+    static_assert(ara::core::get<1>(b) == 4);
+    static_assert(noexcept(ara::core::get<0>(a)));
+
+    ara::core::Array<std::string, 1> c{std::string{"moved"}};
+    std::string                      s = ara::core::get<0>(std::move(c));
+    CHECK(s == "moved");
+    static_assert(
+      std::is_same_v<decltype(ara::core::get<0>(std::move(c))), std::string&&>);
+}
+
+TEST_CASE("Array supports structured bindings", "[SWS_CORE], [SWS_CORE_01201]")
+{
+    static_assert(std::tuple_size_v<ara::core::Array<int, 3>> == 3);
+    static_assert(
+      std::is_same_v<std::tuple_element_t<1, ara::core::Array<char, 2>>, char>);
+
+    ara::core::Array<int, 3> a{1, 2, 3};
+    auto& [x, y, z] = a;
+    z               = 4;
+    CHECK(x == 1);
+    CHECK(y == 2);
+    CHECK(a[2] == 4);
+
+    ara::core::AlignedArray<float, 2> const b{0.5f, 1.5f};
+    auto const [u, v] = b;
+    CHECK(u == 0.5f);
+    CHECK(v == 1.5f);
 }
 
 TEST_CASE("to_array", "[SWS_CORE], [SWS_CORE_01201]")
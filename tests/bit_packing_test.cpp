@@ -0,0 +1,165 @@
+#include <catch2/catch.hpp>
+
+#include <array>
+#include <cstdint>
+#include <random>
+
+#include "ara/core/bit_packing.h"
+
+namespace core = ara::core;
+
+namespace {
+
+constexpr std::array<core::Byte, 8> frame{core::Byte{0x12},
+                                          core::Byte{0x34},
+                                          core::Byte{0x56},
+                                          core::Byte{0x78},
+                                          core::Byte{0x9A},
+                                          core::Byte{0xBC},
+                                          core::Byte{0xDE},
+                                          core::Byte{0xF0}};
+
+/**
+ * Payload bit number of bit k of a signal, counted from its least significant
+ * bit, one bit at a time as in the DBC definition.
+ */
+std::size_t
+ReferenceBit(core::Signal const& signal, std::size_t k) noexcept
+{
+    if (signal.order == core::BitOrder::kIntel)
+    {
+        return signal.startBit + k;
+    }
+    std::size_t bit = signal.startBit;
+    for (std::size_t i = signal.length - 1; i > k; --i)
+    {
+        bit = bit % 8 == 0 ? bit + 15 : bit - 1;
+    }
+    return bit;
+}
+
+bool GetBit(core::Span<core::Byte const> payload, std::size_t bit) noexcept
+{
+    return ((core::to_integer<unsigned>(payload[bit / 8]) >> (bit % 8)) & 1u)
+           != 0;
+}
+
+}  // namespace
+
+TEST_CASE("BitReader reads Intel signals", "[SWS_CORE]")
+{
+    core::BitReader const reader{frame};
+
+    CHECK(reader.Read(0, 8) == 0x12);
+    CHECK(reader.Read(4, 8) == 0x41);
+    CHECK(reader.Read(0, 16) == 0x3412);
+    CHECK(reader.Read(60, 4) == 0xF);
+    CHECK(reader.Read(0, 64) == 0xF0DEBC9A78563412);
+    CHECK(reader.Read(4, 60) == 0xF0DEBC9A7856341);
+    CHECK(reader.ReadSigned(56, 8) == -16);
+    CHECK(reader.ReadSigned(0, 8) == 0x12);
+}
+
+TEST_CASE("BitReader reads Motorola signals", "[SWS_CORE]")
+{
+    core::BitReader const reader{frame};
+
+    CHECK(reader.Read(7, 8, core::BitOrder::kMotorola) == 0x12);
+    CHECK(reader.Read(7, 16, core::BitOrder::kMotorola) == 0x1234);
+    CHECK(reader.Read(3, 8, core::BitOrder::kMotorola) == 0x23);
+    CHECK(reader.Read(7, 64, core::BitOrder::kMotorola) == 0x123456789ABCDEF0);
+    CHECK(reader.Read(3, 60, core::BitOrder::kMotorola) == 0x23456789ABCDEF0);
+    CHECK(reader.ReadSigned(55, 4, core::BitOrder::kMotorola) == -3);
+}
+
+TEST_CASE("BitReader and BitWriter are usable in constant expressions",
+          "[SWS_CORE]")
+{
+    static_assert(core::BitReader{frame}.Read(7, 16, core::BitOrder::kMotorola)
+                  == 0x1234);
+
+    constexpr auto written = [] {
+        std::array<core::Byte, 2> out{};
+        core::BitWriter{out}.Write(3, 10, core::BitOrder::kIntel, 0x3FF);
+        return out;
+    }();
+    static_assert(written[0] == core::Byte{0xF8});
+    static_assert(written[1] == core::Byte{0x1F});
+}
+
+TEST_CASE("BitWriter writes signals matching the bitwise definition",
+          "[SWS_CORE]")
+{
+    std::mt19937_64 random{42};
+
+    for (int iteration = 0; iteration < 500; ++iteration)
+    {
+        core::Signal signal{};
+        signal.order  = random() % 2 == 0 ? core::BitOrder::kIntel
+                                          : core::BitOrder::kMotorola;
+        signal.length = 1 + random() % 64;
+        do
+        {
+            signal.startBit = random() % 96;
+        } while (! signal.FitsInto(12));
+
+        std::array<core::Byte, 12> payload;
+        for (auto& b : payload)
+        {
+            b = core::Byte{static_cast<std::uint8_t>(random())};
+        }
+        auto const          before = payload;
+        std::uint64_t const value  = random();
+
+        core::BitWriter{payload}.Write(
+          signal.startBit, signal.length, signal.order, value);
+
+        std::array<bool, 96> covered{};
+        for (std::size_t k = 0; k < signal.length; ++k)
+        {
+            std::size_t const bit = ReferenceBit(signal, k);
+            covered[bit]          = true;
+            REQUIRE(GetBit(payload, bit) == (((value >> k) & 1u) != 0));
+        }
+        for (std::size_t bit = 0; bit < 96; ++bit)
+        {
+            if (! covered[bit])
+            {
+                REQUIRE(GetBit(payload, bit) == GetBit(before, bit));
+            }
+        }
+
+        auto const mask = signal.length == 64
+                            ? ~std::uint64_t{0}
+                            : (std::uint64_t{1} << signal.length) - 1;
+        REQUIRE(core::BitReader{payload}.Read(
+                  signal.startBit, signal.length, signal.order)
+                == (value & mask));
+    }
+}
+
+TEST_CASE("SignalLayout unpacks and packs a whole frame", "[SWS_CORE]")
+{
+    constexpr auto motorola = core::BitOrder::kMotorola;
+    using Layout            = core::SignalLayout<8,
+                                      core::Signal{0, 12},
+                                      core::Signal{12, 4},
+                                      core::Signal{23, 16, motorola},
+                                      core::Signal{40, 24}>;
+    static_assert(Layout::signalCount == 4);
+    static_assert(! core::Signal{60, 8}.FitsInto(8));
+    static_assert(! core::Signal{0, 0}.FitsInto(8));
+
+    auto const values = Layout::Unpack(frame);
+    CHECK(values[0] == 0x412);
+    CHECK(values[1] == 0x3);
+    CHECK(values[2] == 0x5678);
+    CHECK(values[3] == 0xF0DEBC);
+
+    std::array<core::Byte, 8> packed{};
+    packed[4] = core::Byte{0x9A};
+    Layout::Pack(values, packed);
+    CHECK(packed == frame);
+
+    static_assert(Layout::Unpack(frame)[2] == 0x5678);
+}
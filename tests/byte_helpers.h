@@ -0,0 +1,59 @@
+/**
+ * Copyright (c) 2020
+ * umlaut Software Development and contributors
+ *
+ * SPDX-License-Identifier: MIT
+ */
+#ifndef ARA_CORE_TESTS_BYTE_HELPERS_H_
+#define ARA_CORE_TESTS_BYTE_HELPERS_H_
+
+#include <cstddef>  // std::size_t
+#include <cstdint>
+#include <string_view>
+#include <vector>
+
+#include "ara/core/byte.h"
+
+namespace tests {
+
+/**
+ * Bytes with the given values, e.g. an expected payload.
+ */
+inline std::vector<ara::core::Byte>
+Bytes(std::vector<unsigned char> const& values)
+{
+    std::vector<ara::core::Byte> bytes;
+    for (auto const value : values) { bytes.emplace_back(value); }
+    return bytes;
+}
+
+/**
+ * Bytes of the characters of a text, e.g. a check string of a test vector.
+ */
+inline std::vector<ara::core::Byte> TextBytes(std::string_view text)
+{
+    std::vector<ara::core::Byte> bytes;
+    for (char const c : text)
+    {
+        bytes.emplace_back(static_cast<std::uint8_t>(c));
+    }
+    return bytes;
+}
+
+/**
+ * n bytes of a simple pattern, which differs for different seeds.
+ */
+inline std::vector<ara::core::Byte>
+PatternBytes(std::size_t n, std::uint8_t seed)
+{
+    std::vector<ara::core::Byte> bytes;
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        bytes.emplace_back(static_cast<std::uint8_t>(i * 37 + seed));
+    }
+    return bytes;
+}
+
+}  // namespace tests
+
+#endif  // ARA_CORE_TESTS_BYTE_HELPERS_H_
@@ -0,0 +1,69 @@
+#include <catch2/catch.hpp>
+
+#include <cstdint>
+#include <vector>
+
+#include "ara/core/byte_operations.h"
+#include "byte_helpers.h"
+
+namespace core = ara::core;
+using tests::PatternBytes;
+
+TEST_CASE("Bulk bitwise operations match the ByteImpl operators",
+          "[SWS_CORE]")
+{
+    for (std::size_t n : {0u, 1u, 7u, 8u, 31u, 32u, 33u, 100u, 4096u})
+    {
+        auto const a = PatternBytes(n, 1);
+        auto const b = PatternBytes(n, 200);
+
+        auto andBytes = a;
+        auto orBytes  = a;
+        auto xorBytes = a;
+        auto notBytes = a;
+        core::AndBytes(andBytes, b);
+        core::OrBytes(orBytes, b);
+        core::XorBytes(xorBytes, b);
+        core::NotBytes(notBytes);
+
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            REQUIRE(andBytes[i] == (a[i] & b[i]));
+            REQUIRE(orBytes[i] == (a[i] | b[i]));
+            REQUIRE(xorBytes[i] == (a[i] ^ b[i]));
+            REQUIRE(notBytes[i] == ~a[i]);
+        }
+    }
+}
+
+TEST_CASE("Bulk bitwise operations stop at the shorter span", "[SWS_CORE]")
+{
+    auto       bytes = PatternBytes(40, 3);
+    auto const copy  = bytes;
+    auto const mask  = std::vector<core::Byte>(35, core::Byte{0});
+
+    core::AndBytes(bytes, mask);
+
+    for (std::size_t i = 0; i < 35; ++i) { CHECK(bytes[i] == core::Byte{0}); }
+    for (std::size_t i = 35; i < 40; ++i) { CHECK(bytes[i] == copy[i]); }
+}
+
+TEST_CASE("PopCount counts the set bits", "[SWS_CORE]")
+{
+    for (std::size_t n : {0u, 1u, 9u, 32u, 65u, 1000u})
+    {
+        auto const  bytes    = PatternBytes(n, 5);
+        std::size_t expected = 0;
+        for (auto b : bytes)
+        {
+            for (auto v = core::to_integer<unsigned>(b); v != 0; v >>= 1)
+            {
+                expected += v & 1u;
+            }
+        }
+        CHECK(core::PopCount(bytes) == expected);
+    }
+
+    std::vector<core::Byte> const ones(100, core::Byte{0xFF});
+    CHECK(core::PopCount(ones) == 800);
+}
@@ -0,0 +1,114 @@
+#include <catch2/catch.hpp>
+
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#include "ara/core/checksum.h"
+#include "byte_helpers.h"
+
+namespace core = ara::core;
+using tests::TextBytes;
+
+namespace {
+
+/**
+ * Bit-at-a-time reference implementation of a reflected CRC.
+ */
+std::uint64_t ReferenceReflected(std::vector<core::Byte> const& data,
+                                 std::uint64_t                  poly,
+                                 std::uint64_t                  init,
+                                 std::uint64_t                  xorOut)
+{
+    std::uint64_t crc = init;
+    for (auto b : data)
+    {
+        crc ^= core::to_integer<std::uint64_t>(b);
+        for (int bit = 0; bit < 8; ++bit)
+        {
+            crc = (crc & 1) != 0 ? (crc >> 1) ^ poly : crc >> 1;
+        }
+    }
+    return crc ^ xorOut;
+}
+
+}  // namespace
+
+TEST_CASE("CRCs match their check values", "[SWS_CORE]")
+{
+    auto const check = TextBytes("123456789");
+
+    CHECK(core::Crc8SaeJ1850::Compute(check) == 0x4B);
+    CHECK(core::Crc16CcittFalse::Compute(check) == 0x29B1);
+    CHECK(core::Crc32::Compute(check) == 0xCBF43926);
+    CHECK(core::Crc32C::Compute(check) == 0xE3069283);
+    CHECK(core::Crc64Xz::Compute(check) == 0x995DC9BBDF1939FA);
+}
+
+TEST_CASE("CRCs of empty data are the initial value after the final XOR",
+          "[SWS_CORE]")
+{
+    CHECK(core::Crc8SaeJ1850::Compute({}) == 0x00);
+    CHECK(core::Crc16CcittFalse::Compute({}) == 0xFFFF);
+    CHECK(core::Crc32::Compute({}) == 0);
+    CHECK(core::Crc32C::Compute({}) == 0);
+    CHECK(core::Crc64Xz::Compute({}) == 0);
+}
+
+TEST_CASE("CRCs can be computed incrementally", "[SWS_CORE]")
+{
+    std::mt19937            random{7};
+    std::vector<core::Byte> data;
+    for (int i = 0; i < 1000; ++i)
+    {
+        data.emplace_back(static_cast<std::uint8_t>(random()));
+    }
+    core::Span<core::Byte const> const span{data};
+
+    for (std::size_t split : {0u, 1u, 7u, 8u, 9u, 500u, 999u, 1000u})
+    {
+        core::Crc32C crc32c;
+        crc32c.Update(span.first(split)).Update(span.subspan(split));
+        CHECK(crc32c.Value() == core::Crc32C::Compute(span));
+
+        core::Crc16CcittFalse crc16;
+        crc16.Update(span.first(split)).Update(span.subspan(split));
+        CHECK(crc16.Value() == core::Crc16CcittFalse::Compute(span));
+
+        core::Crc8SaeJ1850 crc8;
+        crc8.Update(span.first(split)).Update(span.subspan(split));
+        CHECK(crc8.Value() == core::Crc8SaeJ1850::Compute(span));
+    }
+
+    core::Crc64Xz crc64;
+    crc64.Update(span);
+    crc64.Reset();
+    CHECK(crc64.Update(TextBytes("123456789")).Value() == 0x995DC9BBDF1939FA);
+}
+
+TEST_CASE("Sliced and accelerated CRCs match a bitwise implementation",
+          "[SWS_CORE]")
+{
+    std::mt19937 random{11};
+    for (std::size_t n : {1u, 3u, 8u, 15u, 16u, 17u, 64u, 255u, 4096u})
+    {
+        std::vector<core::Byte> data;
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            data.emplace_back(static_cast<std::uint8_t>(random()));
+        }
+
+        CHECK(core::Crc32::Compute(data)
+              == ReferenceReflected(data, 0xEDB88320, 0xFFFFFFFF, 0xFFFFFFFF));
+        CHECK(core::Crc32C::Compute(data)
+              == ReferenceReflected(data, 0x82F63B78, 0xFFFFFFFF, 0xFFFFFFFF));
+        CHECK((core::internal::Crc32CUpdateSliced(0xFFFFFFFF, data)
+               ^ 0xFFFFFFFF)
+              == ReferenceReflected(data, 0x82F63B78, 0xFFFFFFFF, 0xFFFFFFFF));
+        CHECK(core::Crc64Xz::Compute(data)
+              == ReferenceReflected(data,
+                                    0xC96C5795D7870F42,
+                                    0xFFFFFFFFFFFFFFFF,
+                                    0xFFFFFFFFFFFFFFFF));
+    }
+}
@@ -1,6 +1,8 @@
 #include <catch2/catch.hpp>
 
+#include <cstdio>   // std::tmpfile
 #include <cstring>  // strcmp
+#include <type_traits>
 
 #include "ara/core/core_error_domain.h"
 
@@ -9,6 +11,8 @@ namespace core = ara::core;
 TEST_CASE("CoreErrc has correct values", "[SWS_CORE],[SWS_CORE_05200]")
 {
     CHECK(static_cast<int>(core::CoreErrc::kInvalidArgument) == 22);
+    CHECK(static_cast<int>(core::CoreErrc::kQueueEmpty) == 61);
+    CHECK(static_cast<int>(core::CoreErrc::kQueueFull) == 105);
     CHECK(static_cast<int>(core::CoreErrc::kInvalidMetaModelShortname) == 137);
     CHECK(static_cast<int>(core::CoreErrc::kInvalidMetaModelPath) == 138);
 }
@@ -39,6 +43,16 @@ TEST_CASE(
                     core::CoreErrc::kInvalidArgument)),
                   "an invalid argument was passed to a function")
       == 0);
+    CHECK(
+      std::strcmp(coreError.Message(static_cast<core::ErrorDomain::CodeType>(
+                    core::CoreErrc::kQueueEmpty)),
+                  "no element is available to be taken from a queue")
+      == 0);
+    CHECK(
+      std::strcmp(coreError.Message(static_cast<core::ErrorDomain::CodeType>(
+                    core::CoreErrc::kQueueFull)),
+                  "no space is available to add an element to a queue")
+      == 0);
     CHECK(
       std::strcmp(coreError.Message(static_cast<core::ErrorDomain::CodeType>(
                     core::CoreErrc::kInvalidMetaModelShortname)),
@@ -80,7 +94,30 @@ TEST_CASE("MakeErrorCode returns proper ErrorCode",
 
     CHECK(error.Domain() == core::GetCoreErrorDomain());
     CHECK(error.SupportData() == core::ErrorDomain::SupportDataType{0});
-    CHECK(error.Message() == core::GetCoreErrorDomain().Name());
+    CHECK(error.Message() == "an invalid argument was passed to a function");
+}
+
+TEST_CASE("ErrorCode::Message returns the message of the code value",
+          "[SWS_CORE], [SWS_CORE_00518]")
+{
+    auto const message = [](core::CoreErrc code) {
+        return core::MakeErrorCode(code, core::ErrorDomain::SupportDataType{0})
+          .Message();
+    };
+
+    CHECK(message(core::CoreErrc::kInvalidArgument)
+          == "an invalid argument was passed to a function");
+    CHECK(message(core::CoreErrc::kInvalidMetaModelShortname)
+          == "given string is not a valid model element shortname");
+    CHECK(message(core::CoreErrc::kInvalidMetaModelPath)
+          == "missing or invalid path to model element");
+    CHECK(message(core::CoreErrc{0}) == "Invalid code value");
+    CHECK(message(core::CoreErrc{100}) == "Invalid code value");
+    CHECK(message(core::CoreErrc{1000}) == "Invalid code value");
+
+    constexpr core::StringView expected{
+      "missing or invalid path to model element"};
+    static_assert(message(core::CoreErrc::kInvalidMetaModelPath) == expected);
 }
 
 TEST_CASE("CoreException can be created and contains proper values",
@@ -94,3 +131,111 @@ TEST_CASE("CoreException can be created and contains proper values",
     CHECK(ex.what() == error.Message());
     CHECK(ex.Error() == error);
 }
+
+TEST_CASE("CoreErrorDomain can be described at compile time", "[SWS_CORE]")
+{
+    static_assert(core::CoreErrorDomain::StaticName() == "Core");
+    static_assert(core::CoreErrorDomain::StaticMessage(22)
+                  == "an invalid argument was passed to a function");
+    static_assert(core::ErrorMessage(core::CoreErrc::kInvalidMetaModelPath)
+                  == "missing or invalid path to model element");
+    static_assert(core::StringView{core::GetCoreErrorDomain().Name()}
+                  == "Core");
+    static_assert(
+      core::StringView{core::GetCoreErrorDomain().Message(137)}
+      == "given string is not a valid model element shortname");
+
+    constexpr core::ErrorCode error = core::MakeErrorCode(
+      core::CoreErrc::kInvalidArgument, core::ErrorDomain::SupportDataType{0});
+    static_assert(error.Domain() == core::GetCoreErrorDomain());
+    static_assert(error.Message() == core::ErrorMessage(core::CoreErrc{22}));
+}
+
+TEST_CASE("ThrowError throws the exception type of the domain", "[SWS_CORE]")
+{
+    CHECK_THROWS_AS(core::ThrowError(core::CoreErrc::kInvalidArgument),
+                    core::CoreException);
+    auto const error = core::MakeErrorCode(
+      core::CoreErrc::kInvalidArgument, core::ErrorDomain::SupportDataType{});
+    CHECK_THROWS_AS(core::CoreErrorDomain::StaticThrowAsException(error),
+                    core::CoreException);
+}
+
+TEST_CASE("ErrorCode can be constructed from an error code enum",
+          "[SWS_CORE], [SWS_CORE_00512]")
+{
+    constexpr core::ErrorCode error{core::CoreErrc::kInvalidMetaModelPath,
+                                    core::ErrorDomain::SupportDataType{5}};
+    static_assert(error.Value() == 138);
+    static_assert(error.SupportData() == 5);
+    static_assert(error.Domain() == core::GetCoreErrorDomain());
+
+    constexpr core::ErrorCode defaulted = core::CoreErrc::kInvalidArgument;
+    static_assert(defaulted.Value() == 22);
+    static_assert(defaulted.SupportData() == 0);
+    static_assert(defaulted == core::CoreErrc::kInvalidArgument);
+    static_assert(defaulted != core::CoreErrc::kInvalidMetaModelPath);
+
+    core::ErrorCode const runtime{core::CoreErrc::kInvalidArgument};
+    CHECK(runtime == defaulted);
+    CHECK(runtime.Message() == "an invalid argument was passed to a function");
+}
+
+TEST_CASE("ErrorCode enum constructor only accepts enum types",
+          "[SWS_CORE], [SWS_CORE_00512]")
+{
+    CHECK(std::is_nothrow_constructible_v<core::ErrorCode, core::CoreErrc>);
+    CHECK(std::is_convertible_v<core::CoreErrc, core::ErrorCode>);
+    CHECK_FALSE(std::is_constructible_v<core::ErrorCode, int>);
+    CHECK_FALSE(std::is_constructible_v<core::ErrorCode,
+                                        core::ErrorDomain::CodeType,
+                                        core::ErrorDomain::SupportDataType>);
+}
+
+TEST_CASE("CoreException keeps a copy of a temporary ErrorCode",
+          "[SWS_CORE], [SWS_CORE_00611], [SWS_CORE_00612], [SWS_CORE_00613]")
+{
+    try
+    {
+        core::GetCoreErrorDomain().ThrowAsException(
+          core::ErrorCode{core::CoreErrc::kInvalidMetaModelShortname,
+                          core::ErrorDomain::SupportDataType{3}});
+        FAIL("no exception thrown");
+    }
+    catch (core::Exception const& ex)
+    {
+        CHECK(ex.Error() == core::CoreErrc::kInvalidMetaModelShortname);
+        CHECK(ex.Error().SupportData() == 3);
+        CHECK(core::StringView{ex.what()}
+              == "given string is not a valid model element shortname");
+    }
+}
+
+TEST_CASE("CoreException captures the stack trace if enabled", "[SWS_CORE]")
+{
+    try
+    {
+        core::ThrowError(core::CoreErrc::kInvalidArgument);
+        FAIL("no exception thrown");
+    }
+    catch (core::Exception const& ex)
+    {
+        auto const stackTrace = ex.StackTrace();
+        if constexpr (core::kExceptionBacktraceEnabled)
+        {
+            CHECK(! stackTrace.empty());
+            CHECK(stackTrace.size() <= core::kMaxStackTraceFrames);
+            CHECK(stackTrace[0] != nullptr);
+        }
+        else
+        {
+            CHECK(stackTrace.empty());
+        }
+
+        std::FILE* file = std::tmpfile();
+        REQUIRE(file != nullptr);
+        ex.WriteStackTrace(fileno(file));
+        CHECK((std::ftell(file) > 0) == core::kExceptionBacktraceEnabled);
+        std::fclose(file);
+    }
+}
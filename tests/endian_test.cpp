@@ -0,0 +1,110 @@
+#include <catch2/catch.hpp>
+
+#include <array>
+#include <cstdint>
+#include <vector>
+
+#include "ara/core/endian.h"
+
+namespace core = ara::core;
+
+namespace {
+
+template<std::size_t N> constexpr std::array<core::Byte, N>
+MakeBytes(std::array<std::uint8_t, N> const& values)
+{
+    std::array<core::Byte, N> bytes{};
+    for (std::size_t i = 0; i < N; ++i) { bytes[i] = core::Byte{values[i]}; }
+    return bytes;
+}
+
+constexpr auto frame =
+  MakeBytes<8>({0x01, 0x23, 0x45, 0x67, 0x89, 0xAB, 0xCD, 0xEF});
+
+}  // namespace
+
+TEST_CASE("ByteSwap reverses the byte order", "[SWS_CORE]")
+{
+    static_assert(core::ByteSwap(std::uint8_t{0x12}) == 0x12);
+    static_assert(core::ByteSwap(std::uint16_t{0x1234}) == 0x3412);
+    static_assert(core::ByteSwap(std::uint32_t{0x12345678}) == 0x78563412);
+    static_assert(core::ByteSwap(std::uint64_t{0x0123456789ABCDEF})
+                  == 0xEFCDAB8967452301);
+    static_assert(core::ByteSwap(std::int16_t{-2}) == std::int16_t{-257});
+}
+
+TEST_CASE("Load integers in big and little endian order", "[SWS_CORE]")
+{
+    core::Span<core::Byte const> const bytes{frame};
+
+    CHECK(core::LoadBigEndian<std::uint16_t>(bytes.first<2>()) == 0x0123);
+    CHECK(core::LoadLittleEndian<std::uint16_t>(bytes.first<2>()) == 0x2301);
+    CHECK(core::LoadBigEndian<std::uint32_t>(bytes.subspan<1, 4>())
+          == 0x23456789);
+    CHECK(core::LoadLittleEndian<std::uint32_t>(bytes.subspan<1, 4>())
+          == 0x89674523);
+    CHECK(core::LoadBigEndian<std::uint64_t>(bytes.first<8>())
+          == 0x0123456789ABCDEF);
+    CHECK(core::LoadLittleEndian<std::uint64_t>(bytes.first<8>())
+          == 0xEFCDAB8967452301);
+    CHECK(core::LoadBigEndian<std::int16_t>(bytes.subspan<6, 2>())
+          == std::int16_t{-12817});
+
+    static_assert(core::LoadBigEndian<std::uint32_t>(
+                    core::Span<core::Byte const, 4>{frame.data(), 4})
+                  == 0x01234567);
+    static_assert(core::LoadLittleEndian<std::int64_t>(
+                    core::Span<core::Byte const, 8>{frame})
+                  == static_cast<std::int64_t>(0xEFCDAB8967452301));
+}
+
+TEST_CASE("Store integers in big and little endian order", "[SWS_CORE]")
+{
+    std::array<core::Byte, 8> bytes{};
+    core::Span<core::Byte>    span{bytes};
+
+    core::StoreBigEndian(std::uint64_t{0x0123456789ABCDEF}, span.first<8>());
+    CHECK(bytes == frame);
+
+    core::StoreLittleEndian(std::uint32_t{0x89674523}, span.subspan<1, 4>());
+    CHECK(bytes == frame);
+
+    core::StoreLittleEndian(std::int16_t{-2}, span.first<2>());
+    CHECK(bytes[0] == core::Byte{0xFE});
+    CHECK(bytes[1] == core::Byte{0xFF});
+
+    constexpr auto stored = [] {
+        std::array<core::Byte, 4> out{};
+        core::StoreBigEndian(std::uint32_t{0x01234567},
+                             core::Span<core::Byte, 4>{out});
+        return out;
+    }();
+    static_assert(stored[0] == core::Byte{0x01});
+    static_assert(stored[3] == core::Byte{0x67});
+}
+
+TEST_CASE("Batch load and store of integer arrays", "[SWS_CORE]")
+{
+    std::vector<std::uint16_t> values(4);
+    core::LoadIntegers<std::endian::big>(core::Span<core::Byte const>{frame},
+                                         core::Span<std::uint16_t>{values});
+    CHECK(values == std::vector<std::uint16_t>{0x0123, 0x4567, 0x89AB, 0xCDEF});
+
+    std::array<core::Byte, 8> bytes{};
+    core::StoreIntegers<std::endian::big>(
+      core::Span<std::uint16_t const>{values}, core::Span<core::Byte>{bytes});
+    CHECK(bytes == frame);
+
+    std::vector<std::uint32_t> words(2);
+    core::LoadIntegers<std::endian::little>(core::Span<core::Byte const>{frame},
+                                            core::Span<std::uint32_t>{words});
+    CHECK(words == std::vector<std::uint32_t>{0x67452301, 0xEFCDAB89});
+
+    constexpr auto loaded = [] {
+        std::array<std::uint32_t, 2> out{};
+        core::LoadIntegers<std::endian::big>(
+          core::Span<core::Byte const>{frame}, core::Span<std::uint32_t>{out});
+        return out;
+    }();
+    static_assert(loaded[0] == 0x01234567 && loaded[1] == 0x89ABCDEF);
+}
@@ -0,0 +1,88 @@
+#include <catch2/catch.hpp>
+
+#include <optional>
+#include <vector>
+
+#include "ara/core/array.h"
+#include "ara/core/core_error_domain.h"
+#include "ara/core/error_code_wire.h"
+#include "byte_helpers.h"
+
+namespace core = ara::core;
+using tests::Bytes;
+
+TEST_CASE("EncodeErrorCode writes domain Id, value and support data",
+          "[SWS_CORE]")
+{
+    auto const code =
+      core::MakeErrorCode(core::CoreErrc::kInvalidMetaModelPath,
+                          core::ErrorDomain::SupportDataType{0x01020304});
+    core::Array<core::Byte, core::kErrorCodeWireSize> out;
+
+    core::EncodeErrorCode(code, core::Span<core::Byte, 16>{out.data(), 16});
+
+    auto const expected = Bytes({0x14, 0, 0, 0, 0, 0, 0, 0x80,  // Id
+                                 138, 0, 0, 0,                  // value
+                                 0x04, 0x03, 0x02, 0x01});      // data
+    CHECK(std::equal(out.begin(), out.end(), expected.begin()));
+}
+
+TEST_CASE("DecodeErrorCode restores an encoded ErrorCode", "[SWS_CORE]")
+{
+    for (auto const errc : {core::CoreErrc::kInvalidArgument,
+                            core::CoreErrc::kInvalidMetaModelShortname,
+                            core::CoreErrc::kInvalidMetaModelPath,
+                            core::CoreErrc{-1}})
+    {
+        auto const code = core::MakeErrorCode(
+          errc, core::ErrorDomain::SupportDataType{0xdeadbeef});
+        core::Array<core::Byte, core::kErrorCodeWireSize> buffer;
+
+        core::EncodeErrorCode(code,
+                              core::Span<core::Byte, 16>{buffer.data(), 16});
+        auto const decoded = core::DecodeErrorCode(
+          core::Span<core::Byte const, 16>{buffer.data(), 16});
+
+        REQUIRE(decoded);
+        CHECK(*decoded == code);
+        CHECK(decoded->SupportData() == code.SupportData());
+        CHECK(decoded->Message() == code.Message());
+    }
+}
+
+TEST_CASE("DecodeErrorCode rejects unknown domains", "[SWS_CORE]")
+{
+    auto const bytes = Bytes({1, 2, 3, 4, 5, 6, 7, 8, 0, 0, 0, 0, 0, 0, 0, 0});
+
+    CHECK_FALSE(core::DecodeErrorCode(
+      core::Span<core::Byte const, 16>{bytes.data(), 16}));
+}
+
+TEST_CASE("ErrorCodes can be encoded and decoded in batches", "[SWS_CORE]")
+{
+    std::vector<core::ErrorCode> codes;
+    for (core::ErrorDomain::SupportDataType i = 0; i < 1000; ++i)
+    {
+        codes.push_back(core::MakeErrorCode(
+          i % 2 ? core::CoreErrc::kInvalidArgument
+                : core::CoreErrc::kInvalidMetaModelPath,
+          i));
+    }
+    std::vector<core::Byte> buffer(codes.size() * core::kErrorCodeWireSize);
+
+    CHECK(core::EncodeErrorCodes(codes, buffer) == buffer.size());
+
+    auto unknown = Bytes({1, 2, 3, 4, 5, 6, 7, 8, 0, 0, 0, 0, 0, 0, 0, 0});
+    buffer.insert(buffer.end(), unknown.begin(), unknown.end());
+    buffer.emplace_back(0);  // incomplete trailing record
+
+    std::vector<std::optional<core::ErrorCode>> decoded(codes.size() + 1);
+    CHECK(core::DecodeErrorCodes(buffer, decoded) == codes.size());
+    for (std::size_t i = 0; i < codes.size(); ++i)
+    {
+        REQUIRE(decoded[i]);
+        REQUIRE(*decoded[i] == codes[i]);
+        REQUIRE(decoded[i]->SupportData() == codes[i].SupportData());
+    }
+    CHECK_FALSE(decoded.back());
+}
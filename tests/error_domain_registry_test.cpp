@@ -0,0 +1,111 @@
+#include <catch2/catch.hpp>
+
+#include <deque>
+#include <thread>
+#include <vector>
+
+#include "ara/core/core_error_domain.h"
+#include "ara/core/error_domain_registry.h"
+
+namespace core = ara::core;
+
+namespace {
+
+struct RegistryTestErrorDomain final : core::ErrorDomain
+{
+    constexpr explicit RegistryTestErrorDomain(IdType id) : ErrorDomain(id) {}
+
+    char const* Name() const noexcept override { return "RegistryTest"; }
+
+    char const* Message(CodeType /*errorCode*/) const noexcept override
+    {
+        return "registry test error";
+    }
+
+    void ThrowAsException(core::ErrorCode const& /*errorCode*/) const
+      noexcept(false) override
+    {}
+};
+
+constexpr RegistryTestErrorDomain staticDomain{0x8000000000001001};
+core::ErrorDomainRegistration const staticRegistration{staticDomain};
+
+}  // namespace
+
+TEST_CASE("CoreErrorDomain is always registered", "[SWS_CORE]")
+{
+    auto const* domain = core::FindErrorDomain(0x8000000000000014);
+
+    REQUIRE(domain != nullptr);
+    CHECK(*domain == core::GetCoreErrorDomain());
+    CHECK(core::RegisterErrorDomain(core::GetCoreErrorDomain()));
+}
+
+TEST_CASE("ErrorDomainRegistration registers during static initialization",
+          "[SWS_CORE]")
+{
+    CHECK(staticRegistration.Registered());
+    CHECK(core::FindErrorDomain(staticDomain.Id()) == &staticDomain);
+}
+
+TEST_CASE("FindErrorDomain returns registered domains by Id", "[SWS_CORE]")
+{
+    static RegistryTestErrorDomain const first{0x8000000000001002};
+    static RegistryTestErrorDomain const second{0x8000000000001003};
+
+    CHECK(core::FindErrorDomain(first.Id()) == nullptr);
+    CHECK(core::RegisterErrorDomain(first));
+    CHECK(core::RegisterErrorDomain(second));
+    CHECK(core::RegisterErrorDomain(first));
+
+    CHECK(core::FindErrorDomain(first.Id()) == &first);
+    CHECK(core::FindErrorDomain(second.Id()) == &second);
+    CHECK(core::FindErrorDomain(0x8000000000001004) == nullptr);
+}
+
+TEST_CASE("Domains can be registered from several threads", "[SWS_CORE]")
+{
+    static std::deque<RegistryTestErrorDomain> const domains = [] {
+        std::deque<RegistryTestErrorDomain> result;
+        for (core::ErrorDomain::IdType id = 0; id < 16; ++id)
+        {
+            result.emplace_back(0x8000000000002000 + id);
+        }
+        return result;
+    }();
+
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 4; ++t)
+    {
+        threads.emplace_back([] {
+            for (auto const& domain : domains)
+            {
+                CHECK(core::RegisterErrorDomain(domain));
+            }
+        });
+    }
+    for (auto& thread : threads) { thread.join(); }
+
+    for (auto const& domain : domains)
+    {
+        CHECK(core::FindErrorDomain(domain.Id()) == &domain);
+    }
+}
+
+TEST_CASE("ReconstructErrorCode restores an ErrorCode from its Id",
+          "[SWS_CORE]")
+{
+    auto const original =
+      core::MakeErrorCode(core::CoreErrc::kInvalidMetaModelPath,
+                          core::ErrorDomain::SupportDataType{7});
+
+    auto const restored = core::ReconstructErrorCode(
+      original.Domain().Id(), original.Value(), original.SupportData());
+
+    REQUIRE(restored);
+    CHECK(*restored == original);
+    CHECK(restored->SupportData() == 7);
+    CHECK(restored->Message() == original.Message());
+
+    CHECK_FALSE(core::ReconstructErrorCode(0x8000000000001fff, 1, 0));
+}
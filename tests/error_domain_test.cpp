@@ -12,6 +12,10 @@ struct ErrorDomainTestImpl : ara::core::ErrorDomain
 {
     ErrorDomainTestImpl(IdType id) : ErrorDomain(id) {}
 
+    ErrorDomainTestImpl(IdType id, MessageTable const& messages)
+      : ErrorDomain(id, messages)
+    {}
+
     virtual ~ErrorDomainTestImpl() = default;
 
     char const* Name() const noexcept { return ""; }
@@ -85,3 +89,42 @@ TEST_CASE("Id call returns correct ID", "[SWS_CORE], [SWS_CORE_00151]")
 
     REQUIRE(id1 == errorDomain.Id());
 }
+
+TEST_CASE("ErrorDomain::MessageView falls back to Message without table",
+          "[SWS_CORE]")
+{
+    ErrorDomainTestImpl errorDomain{1};
+
+    CHECK(errorDomain.MessageView(0).empty());
+    CHECK(core::ErrorCode{0, errorDomain}.Message().empty());
+}
+
+namespace {
+
+constexpr core::StringView testMessages[] = {"first", "", "third"};
+
+constexpr core::ErrorDomain::MessageTable testMessageTable{
+  10, testMessages, "unknown"};
+
+struct TableErrorDomainTestImpl : ErrorDomainTestImpl
+{
+    TableErrorDomainTestImpl() : ErrorDomainTestImpl(2, testMessageTable) {}
+};
+
+}  // namespace
+
+TEST_CASE("ErrorDomain::MessageView looks up the MessageTable", "[SWS_CORE]")
+{
+    TableErrorDomainTestImpl errorDomain;
+
+    CHECK(errorDomain.MessageView(10) == "first");
+    CHECK(errorDomain.MessageView(11) == "unknown");
+    CHECK(errorDomain.MessageView(12) == "third");
+    CHECK(errorDomain.MessageView(9) == "unknown");
+    CHECK(errorDomain.MessageView(13) == "unknown");
+    CHECK(errorDomain.MessageView(-2147483647 - 1) == "unknown");
+    CHECK(core::ErrorCode{12, errorDomain}.Message() == "third");
+
+    static_assert(testMessageTable.Lookup(12) == "third");
+    static_assert(testMessageTable.Lookup(2147483647) == "unknown");
+}
@@ -0,0 +1,144 @@
+#include <catch2/catch.hpp>
+
+#include <algorithm>
+#include <optional>
+#include <thread>
+#include <vector>
+
+#include "ara/core/core_error_domain.h"
+#include "ara/core/error_code_wire.h"
+#include "ara/core/error_domain_registry.h"
+#include "ara/core/error_statistics.h"
+
+namespace core = ara::core;
+
+namespace {
+
+core::ErrorStatisticsEntry
+FindEntry(core::ErrorStatisticsSnapshot const& snapshot, core::CoreErrc code)
+{
+    auto const domain = core::GetCoreErrorDomain().Id();
+    auto const value  = static_cast<core::ErrorDomain::CodeType>(code);
+    auto const it     = std::find_if(
+      snapshot.entries.begin(),
+      snapshot.entries.end(),
+      [&](core::ErrorStatisticsEntry const& entry) {
+          return entry.domain == domain && entry.code == value;
+      });
+    return it != snapshot.entries.end() ? *it
+                                        : core::ErrorStatisticsEntry{
+                                          domain, value, 0, 0};
+}
+
+}  // namespace
+
+TEST_CASE("Error statistics count created and thrown errors", "[SWS_CORE]")
+{
+    auto const before = core::TakeErrorStatisticsSnapshot();
+
+    core::ErrorCode const error = core::CoreErrc::kInvalidArgument;
+    core::ErrorCode const copy  = error;
+    CHECK_THROWS_AS(error.ThrowAsException(), core::CoreException);
+    constexpr core::ErrorCode constant = core::CoreErrc::kInvalidArgument;
+    CHECK(constant == copy);
+
+    auto const after = core::TakeErrorStatisticsSnapshot();
+    auto const first = FindEntry(before, core::CoreErrc::kInvalidArgument);
+    auto const last  = FindEntry(after, core::CoreErrc::kInvalidArgument);
+
+    CHECK(last.created - first.created == 1);
+    CHECK(last.thrown - first.thrown == 1);
+}
+
+TEST_CASE("Error statistics do not count restored errors", "[SWS_CORE]")
+{
+    auto const            code  = core::CoreErrc::kInvalidMetaModelShortname;
+    core::ErrorCode const error = code;
+    core::Byte            wire[core::kErrorCodeWireSize];
+    core::EncodeErrorCode(error, wire);
+    auto const before = core::TakeErrorStatisticsSnapshot();
+
+    auto const decoded  = core::DecodeErrorCode(wire);
+    auto const restored = core::ReconstructErrorCode(
+      error.Domain().Id(), error.Value(), error.SupportData());
+
+    auto const after = core::TakeErrorStatisticsSnapshot();
+    auto const first = FindEntry(before, code);
+    auto const last  = FindEntry(after, code);
+
+    REQUIRE(decoded);
+    REQUIRE(restored);
+    CHECK(last.created == first.created);
+}
+
+TEST_CASE("Error statistics do not count batch decoded errors", "[SWS_CORE]")
+{
+    constexpr std::size_t kCount = 100;
+    auto const            code   = core::CoreErrc::kInvalidMetaModelShortname;
+    std::vector<core::ErrorCode> const errors(kCount, core::ErrorCode{code});
+    std::vector<core::Byte>            wire(kCount * core::kErrorCodeWireSize);
+    core::EncodeErrorCodes(errors, wire);
+    std::vector<std::optional<core::ErrorCode>> decoded(kCount);
+    auto const before = core::TakeErrorStatisticsSnapshot();
+
+    auto const count = core::DecodeErrorCodes(wire, decoded);
+
+    auto const after = core::TakeErrorStatisticsSnapshot();
+    auto const first = FindEntry(before, code);
+    auto const last  = FindEntry(after, code);
+
+    REQUIRE(count == kCount);
+    CHECK(decoded.back() == errors.back());
+    CHECK(last.created == first.created);
+}
+
+TEST_CASE("Error statistics aggregate all threads", "[SWS_CORE]")
+{
+    constexpr std::size_t kThreads = 32;
+    constexpr std::size_t kErrors  = 1000;
+
+    auto const before = core::TakeErrorStatisticsSnapshot();
+
+    std::vector<std::thread> threads;
+    for (std::size_t t = 0; t < kThreads; ++t)
+    {
+        threads.emplace_back([] {
+            for (std::size_t i = 0; i < kErrors; ++i)
+            {
+                core::ErrorCode const error =
+                  core::CoreErrc::kInvalidMetaModelPath;
+                (void)error;
+            }
+        });
+    }
+    for (auto& thread : threads) { thread.join(); }
+
+    auto const after = core::TakeErrorStatisticsSnapshot();
+    auto const first = FindEntry(before, core::CoreErrc::kInvalidMetaModelPath);
+    auto const last  = FindEntry(after, core::CoreErrc::kInvalidMetaModelPath);
+
+    CHECK(last.created - first.created == kThreads * kErrors);
+}
+
+TEST_CASE("ErrorRates divides count differences by elapsed time", "[SWS_CORE]")
+{
+    using namespace std::chrono_literals;
+
+    core::ErrorStatisticsSnapshot earlier{
+      std::chrono::steady_clock::time_point{}, {{1, 1, 10, 0}, {1, 3, 5, 5}}};
+    core::ErrorStatisticsSnapshot later{
+      earlier.time + 2s, {{1, 1, 30, 4}, {1, 2, 8, 0}, {1, 3, 5, 5}}};
+
+    auto const rates = core::ErrorRates(earlier, later);
+
+    REQUIRE(rates.size() == 3);
+    CHECK(rates[0].code == 1);
+    CHECK(rates[0].created == Approx(10.0));
+    CHECK(rates[0].thrown == Approx(2.0));
+    CHECK(rates[1].code == 2);
+    CHECK(rates[1].created == Approx(4.0));
+    CHECK(rates[2].code == 3);
+    CHECK(rates[2].created == Approx(0.0));
+
+    CHECK(core::ErrorRates(later, later)[0].created == Approx(0.0));
+}
@@ -0,0 +1,83 @@
+#include <catch2/catch.hpp>
+
+#include <cstring>  // strlen
+#include <type_traits>
+
+#include "ara/core/core_error_domain.h"
+#include "ara/core/fixed_string.h"
+
+namespace core = ara::core;
+
+namespace {
+
+template<core::FixedString Name> struct Tagged
+{
+    static constexpr core::StringView name = Name;
+};
+
+}  // namespace
+
+TEST_CASE("FixedString deduces its length from a literal", "[SWS_CORE]")
+{
+    constexpr core::FixedString s{"Core"};
+
+    static_assert(std::is_same_v<decltype(s), core::FixedString<4> const>);
+    static_assert(s.size() == 4);
+    static_assert(! s.empty());
+    static_assert(s[0] == 'C' && s[3] == 'e');
+    CHECK(std::strlen(s.c_str()) == 4);
+    CHECK(s.data()[4] == '\0');
+}
+
+TEST_CASE("FixedString converts to StringView at compile time", "[SWS_CORE]")
+{
+    static constexpr core::FixedString s{"Core"};
+    constexpr core::StringView         view = s;
+
+    static_assert(view == "Core");
+    static_assert(view.size() == 4);
+    CHECK(view.data() == s.data());
+}
+
+TEST_CASE("FixedString can be compared and hashed at compile time",
+          "[SWS_CORE]")
+{
+    constexpr core::FixedString a{"abc"};
+    constexpr core::FixedString b{"abd"};
+    constexpr core::FixedString longer{"abcd"};
+
+    static_assert(a == core::FixedString{"abc"});
+    static_assert(a != b);
+    static_assert(a != longer);
+    static_assert(a < b);
+    static_assert(a < longer);
+    static_assert(a.Hash() == core::internal::Fnv1a("abc"));
+    static_assert(a.Hash() != b.Hash());
+}
+
+TEST_CASE("FixedString can be used as non-type template parameter",
+          "[SWS_CORE]")
+{
+    static_assert(Tagged<"Service">::name == "Service");
+    static_assert(std::is_same_v<Tagged<"Service">, Tagged<"Service">>);
+    static_assert(! std::is_same_v<Tagged<"Service">, Tagged<"Event">>);
+}
+
+TEST_CASE("FixedString can be iterated", "[SWS_CORE]")
+{
+    constexpr core::FixedString s{"abc"};
+    std::size_t                 count = 0;
+    for (char const c : s)
+    {
+        CHECK(c == s[count]);
+        ++count;
+    }
+    CHECK(count == s.size());
+}
+
+TEST_CASE("CoreErrorDomain exposes its name as FixedString", "[SWS_CORE]")
+{
+    static_assert(core::CoreErrorDomain::name == core::FixedString{"Core"});
+    CHECK(core::GetCoreErrorDomain().Name()
+          == core::CoreErrorDomain::name.c_str());
+}
@@ -0,0 +1,112 @@
+#include <catch2/catch.hpp>
+
+#include <string>
+#include <type_traits>
+#include <unordered_set>
+
+#include "ara/core/core_error_domain.h"
+#include "ara/core/instance_specifier.h"
+
+namespace core = ara::core;
+
+TEST_CASE("InstanceSpecifier can be constructed from a valid path",
+          "[SWS_CORE], [SWS_CORE_08001], [SWS_CORE_08021]")
+{
+    core::InstanceSpecifier specifier{"Executable/RootSwc/Port"};
+
+    CHECK(specifier.ToString() == "Executable/RootSwc/Port");
+}
+
+TEST_CASE("InstanceSpecifier throws CoreException for an invalid path",
+          "[SWS_CORE], [SWS_CORE_08021]")
+{
+    CHECK_THROWS_AS(core::InstanceSpecifier{"Executable//Port"},
+                    core::CoreException);
+    CHECK_THROWS_AS(core::InstanceSpecifier{"Executable/1Swc"},
+                    core::CoreException);
+
+    try
+    {
+        core::InstanceSpecifier{"Executable/1Swc"};
+        FAIL("no exception thrown");
+    }
+    catch (core::CoreException const& ex)
+    {
+        CHECK(ex.Error() == core::CoreErrc::kInvalidMetaModelShortname);
+        CHECK(ex.Error().SupportData() == 11);
+    }
+}
+
+TEST_CASE("InstanceSpecifier interns paths created at runtime",
+          "[SWS_CORE], [SWS_CORE_08041]")
+{
+    std::string             first  = "Executable/RootSwc/Port";
+    std::string             second = first;
+    core::InstanceSpecifier lhs{first};
+    core::InstanceSpecifier rhs{second};
+
+    first.clear();
+    second.clear();
+
+    CHECK(lhs.ToString().data() == rhs.ToString().data());
+    CHECK(lhs.ToString() == "Executable/RootSwc/Port");
+    CHECK(lhs.Hash() == rhs.Hash());
+}
+
+TEST_CASE("InstanceSpecifier can be copied and moved",
+          "[SWS_CORE], [SWS_CORE_08022], [SWS_CORE_08023], [SWS_CORE_08024], "
+          "[SWS_CORE_08025], [SWS_CORE_08029]")
+{
+    CHECK(std::is_nothrow_move_constructible_v<core::InstanceSpecifier>);
+    CHECK(std::is_nothrow_move_assignable_v<core::InstanceSpecifier>);
+    CHECK(std::is_trivially_destructible_v<core::InstanceSpecifier>);
+
+    core::InstanceSpecifier specifier{"Exe/Port"};
+    core::InstanceSpecifier copy{specifier};
+    core::InstanceSpecifier other{"Exe/Other"};
+
+    CHECK(copy == specifier);
+    other = copy;
+    CHECK(other == specifier);
+}
+
+TEST_CASE("InstanceSpecifier can be compared",
+          "[SWS_CORE], [SWS_CORE_08042], [SWS_CORE_08043], [SWS_CORE_08044], "
+          "[SWS_CORE_08045], [SWS_CORE_08046]")
+{
+    core::InstanceSpecifier a{"Exe/A"};
+    core::InstanceSpecifier b{"Exe/B"};
+
+    CHECK(a == core::InstanceSpecifier{"Exe/A"});
+    CHECK(a != b);
+    CHECK(a == core::StringView{"Exe/A"});
+    CHECK(a != core::StringView{"Exe/B"});
+    CHECK(a < b);
+    CHECK_FALSE(b < a);
+}
+
+TEST_CASE("InstanceSpecifier can be created at compile time", "[SWS_CORE]")
+{
+    constexpr core::InstanceSpecifier literal{"Exe/A"};
+    static_assert(literal.ToString() == "Exe/A");
+    static_assert(literal.Hash() == core::internal::Fnv1a("Exe/A"));
+    static_assert(literal == core::InstanceSpecifier{"Exe/A"});
+
+    core::InstanceSpecifier runtime{std::string{"Exe/A"}};
+    CHECK(literal == runtime);
+    CHECK(runtime == literal);
+    CHECK(literal.Hash() == runtime.Hash());
+    CHECK(literal != core::InstanceSpecifier{"Exe/B"});
+}
+
+TEST_CASE("InstanceSpecifier can be used as hash key", "[SWS_CORE]")
+{
+    std::unordered_set<core::InstanceSpecifier> set;
+    set.insert(core::InstanceSpecifier{"Exe/A"});
+    set.insert(core::InstanceSpecifier{"Exe/A"});
+    set.insert(core::InstanceSpecifier{"Exe/B"});
+
+    CHECK(set.size() == 2);
+    CHECK(std::hash<core::InstanceSpecifier>{}(core::InstanceSpecifier{"Exe/A"})
+          == core::internal::Fnv1a("Exe/A"));
+}
@@ -0,0 +1,122 @@
+#include <catch2/catch.hpp>
+
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "ara/core/metamodel_validation.h"
+
+namespace core = ara::core;
+
+TEST_CASE("ValidateShortname accepts valid shortnames", "[SWS_CORE]")
+{
+    CHECK_FALSE(core::ValidateShortname("a"));
+    CHECK_FALSE(core::ValidateShortname("RootSwComponent"));
+    CHECK_FALSE(core::ValidateShortname("port_1"));
+    CHECK_FALSE(
+      core::ValidateShortname(std::string(core::kMaxShortnameLength, 'x')));
+}
+
+TEST_CASE("ValidateShortname rejects invalid shortnames", "[SWS_CORE]")
+{
+    core::ErrorCode const expected{core::CoreErrc::kInvalidMetaModelShortname,
+                                   core::ErrorDomain::SupportDataType{0}};
+
+    for (auto const* shortname :
+         {"", "1port", "_port", "port-1", "port/sub", "port name", "pört"})
+    {
+        CAPTURE(shortname);
+        auto const error = core::ValidateShortname(shortname);
+        REQUIRE(error);
+        CHECK(*error == expected);
+    }
+
+    CHECK(core::ValidateShortname(
+      std::string(core::kMaxShortnameLength + 1, 'x')));
+}
+
+TEST_CASE("ValidateShortname reports the offset of the offending character",
+          "[SWS_CORE]")
+{
+    CHECK(core::ValidateShortname("port-1")->SupportData() == 4);
+    CHECK(core::ValidateShortname("port/1")->SupportData() == 4);
+    CHECK(core::ValidateShortname("1port")->SupportData() == 0);
+}
+
+TEST_CASE("ValidateMetaModelPath accepts valid paths", "[SWS_CORE]")
+{
+    CHECK_FALSE(core::ValidateMetaModelPath("Executable"));
+    CHECK_FALSE(core::ValidateMetaModelPath("Executable/RootSwc/Port_1"));
+}
+
+TEST_CASE("ValidateMetaModelPath rejects invalid paths", "[SWS_CORE]")
+{
+    core::ErrorCode const pathError{core::CoreErrc::kInvalidMetaModelPath,
+                                    core::ErrorDomain::SupportDataType{0}};
+    core::ErrorCode const shortnameError{
+      core::CoreErrc::kInvalidMetaModelShortname,
+      core::ErrorDomain::SupportDataType{0}};
+
+    for (auto const* path : {"", "/Executable", "Executable/", "Exe//Port"})
+    {
+        CAPTURE(path);
+        auto const error = core::ValidateMetaModelPath(path);
+        REQUIRE(error);
+        CHECK(*error == pathError);
+    }
+
+    for (auto const* path : {"Executable/1Swc", "Exe/Swc/Po rt", "Exe.Swc"})
+    {
+        CAPTURE(path);
+        auto const error = core::ValidateMetaModelPath(path);
+        REQUIRE(error);
+        CHECK(*error == shortnameError);
+    }
+}
+
+TEST_CASE("ValidateMetaModelPath finds invalid characters in long paths",
+          "[SWS_CORE]")
+{
+    std::string path = "Executable/RootSoftwareComponent/ProvidedPort_1";
+    REQUIRE_FALSE(core::ValidateMetaModelPath(path));
+
+    for (std::size_t i = 0; i < path.size(); ++i)
+    {
+        if (path[i] == '/')
+        {
+            continue;
+        }
+        std::string broken = path;
+        broken[i]          = '$';
+        CAPTURE(broken);
+        auto const error = core::ValidateMetaModelPath(broken);
+        REQUIRE(error);
+        CHECK(error->SupportData() == i);
+    }
+}
+
+TEST_CASE("ValidateMetaModelPath can be evaluated at compile time",
+          "[SWS_CORE]")
+{
+    static_assert(! core::ValidateMetaModelPath("Executable/RootSwc/Port"));
+    static_assert(core::ValidateMetaModelPath("Executable//Port"));
+    static_assert(! core::ValidateShortname("Port"));
+    static_assert(core::ValidateShortname("Po$rt"));
+}
+
+TEST_CASE("ValidateMetaModelPaths validates a batch of paths", "[SWS_CORE]")
+{
+    std::vector<core::StringView> const paths{
+      "Exe/Swc/Port", "Exe//Port", "Exe/Swc/Po$rt", "Exe/Swc/Port_2"};
+    std::vector<std::optional<core::ErrorCode>> results(paths.size());
+
+    CHECK(core::ValidateMetaModelPaths(paths, results) == 2);
+    CHECK_FALSE(results[0]);
+    CHECK(results[1]->Value()
+          == static_cast<core::ErrorDomain::CodeType>(
+            core::CoreErrc::kInvalidMetaModelPath));
+    CHECK(results[2]->Value()
+          == static_cast<core::ErrorDomain::CodeType>(
+            core::CoreErrc::kInvalidMetaModelShortname));
+    CHECK_FALSE(results[3]);
+}
@@ -0,0 +1,182 @@
+#include <catch2/catch.hpp>
+
+#include <atomic>
+#include <cstdint>
+#include <memory>  // std::shared_ptr
+#include <thread>
+#include <vector>
+
+#include "ara/core/core_error_domain.h"
+#include "ara/core/mpmc_queue.h"
+#include "ara/core/vector.h"
+
+namespace core = ara::core;
+
+namespace {
+
+struct WorkItem
+{
+    core::ErrorCode   status;
+    core::Vector<int> data;
+};
+
+constexpr std::uint64_t kProducers   = 4;
+constexpr std::uint64_t kConsumers   = 4;
+constexpr std::uint64_t kPerProducer = 20'000;
+constexpr std::uint64_t kPerConsumer = kProducers * kPerProducer / kConsumers;
+
+/**
+ * Sum of the counters pushed by all producers.
+ */
+constexpr std::uint64_t kExpectedSum =
+  kProducers * kPerProducer * (kPerProducer - 1) / 2;
+
+/**
+ * Values pushed by each producer: its number in the upper bits and a counter
+ * in the lower bits.
+ */
+constexpr std::uint64_t kProducerShift = 32;
+
+}  // namespace
+
+TEST_CASE("MpmcQueue rounds the capacity up to a power of 2", "[SWS_CORE]")
+{
+    CHECK(core::MpmcQueue<int>{0}.Capacity() == 2);
+    CHECK(core::MpmcQueue<int>{2}.Capacity() == 2);
+    CHECK(core::MpmcQueue<int>{5}.Capacity() == 8);
+    CHECK(core::MpmcQueue<int>{1024}.Capacity() == 1024);
+}
+
+TEST_CASE("MpmcQueue reports full and empty as CoreErrc", "[SWS_CORE]")
+{
+    core::MpmcQueue<int> queue{4};
+    int                  value = -1;
+
+    auto const empty = queue.TryPop(value);
+    REQUIRE(empty);
+    CHECK(*empty == core::CoreErrc::kQueueEmpty);
+    CHECK(value == -1);
+
+    for (int round = 0; round < 3; ++round)
+    {
+        for (int i = 0; i < 4; ++i) { CHECK_FALSE(queue.TryPush(i + round)); }
+        CHECK(queue.Size() == 4);
+
+        auto const full = queue.TryPush(99);
+        REQUIRE(full);
+        CHECK(*full == core::CoreErrc::kQueueFull);
+
+        for (int i = 0; i < 4; ++i)
+        {
+            CHECK_FALSE(queue.TryPop(value));
+            CHECK(value == i + round);
+        }
+        CHECK(queue.Empty());
+    }
+}
+
+TEST_CASE("MpmcQueue moves work items", "[SWS_CORE]")
+{
+    core::MpmcQueue<WorkItem> queue{2};
+
+    CHECK_FALSE(queue.TryPush(
+      WorkItem{core::MakeErrorCode(core::CoreErrc::kInvalidArgument, 7),
+               core::Vector<int>{1, 2, 3}}));
+    WorkItem const copy{
+      core::MakeErrorCode(core::CoreErrc::kInvalidMetaModelPath, 0),
+      core::Vector<int>{4}};
+    CHECK_FALSE(queue.TryPush(copy));
+    CHECK(copy.data.size() == 1);
+
+    WorkItem item = queue.Pop();
+    CHECK(item.status == core::CoreErrc::kInvalidArgument);
+    CHECK(item.status.SupportData() == 7);
+    CHECK(item.data == core::Vector<int>{1, 2, 3});
+
+    CHECK_FALSE(queue.TryPop(item));
+    CHECK(item.status == core::CoreErrc::kInvalidMetaModelPath);
+    CHECK(item.data == core::Vector<int>{4});
+}
+
+TEST_CASE("MpmcQueue destroys the elements left", "[SWS_CORE]")
+{
+    auto const shared = std::make_shared<int>(0);
+    {
+        core::MpmcQueue<std::shared_ptr<int>> queue{4};
+        for (int i = 0; i < 6; ++i)
+        {
+            queue.TryPush(shared);
+            std::shared_ptr<int> popped;
+            if (i % 2 == 0) { queue.TryPop(popped); }
+        }
+        CHECK(shared.use_count() == 4);
+    }
+    CHECK(shared.use_count() == 1);
+}
+
+TEST_CASE("MpmcQueue distributes elements between threads", "[SWS_CORE]")
+{
+    core::MpmcQueue<std::uint64_t> queue{64};
+    bool const                     blocking = GENERATE(false, true);
+
+    std::vector<std::thread> producers;
+    for (std::uint64_t p = 0; p < kProducers; ++p)
+    {
+        producers.emplace_back([&queue, blocking, p] {
+            for (std::uint64_t i = 0; i < kPerProducer; ++i)
+            {
+                std::uint64_t const value = p << kProducerShift | i;
+                if (blocking)
+                {
+                    queue.Push(value);
+                    continue;
+                }
+                while (queue.TryPush(value)) { std::this_thread::yield(); }
+            }
+        });
+    }
+
+    std::atomic<std::uint64_t> sum{0};
+    std::atomic<std::uint64_t> count{0};
+    std::atomic<bool>          inOrder{true};
+    std::vector<std::thread>   consumers;
+    for (std::uint64_t c = 0; c < kConsumers; ++c)
+    {
+        consumers.emplace_back([&, blocking] {
+            // elements of one producer are seen in the order pushed
+            std::vector<std::uint64_t> next(kProducers, 0);
+            std::uint64_t              localSum = 0;
+            for (std::uint64_t i = 0; i < kPerConsumer; ++i)
+            {
+                std::uint64_t value = 0;
+                if (blocking)
+                {
+                    value = queue.Pop();
+                }
+                else
+                {
+                    while (queue.TryPop(value)) { std::this_thread::yield(); }
+                }
+                std::uint64_t const producer = value >> kProducerShift;
+                std::uint64_t const counter =
+                  value & ((std::uint64_t{1} << kProducerShift) - 1);
+                if (counter < next[producer])
+                {
+                    inOrder = false;
+                }
+                next[producer] = counter + 1;
+                localSum += counter;
+            }
+            sum += localSum;
+            count += kPerConsumer;
+        });
+    }
+
+    for (auto& thread : producers) { thread.join(); }
+    for (auto& thread : consumers) { thread.join(); }
+
+    CHECK(count == kProducers * kPerProducer);
+    CHECK(sum == kExpectedSum);
+    CHECK(inOrder);
+    CHECK(queue.Empty());
+}
@@ -0,0 +1,273 @@
+#include <catch2/catch.hpp>
+
+#include <cstdint>
+#include <cstring>  // std::memcpy
+#include <limits>
+#include <tuple>
+#include <utility>
+
+#include "ara/core/array.h"
+#include "ara/core/core_error_domain.h"
+#include "ara/core/map.h"
+#include "ara/core/serialization.h"
+#include "ara/core/vector.h"
+
+namespace core = ara::core;
+
+namespace {
+
+struct Sample
+{
+    std::uint64_t                         timestamp;
+    core::Vector<float>                   values;
+    core::Map<std::uint16_t, std::int8_t> flags;
+};
+
+struct Position
+{
+    std::int32_t x;
+    std::int32_t y;
+
+    auto operator<=>(Position const&) const = default;
+};
+
+enum class Level : std::uint8_t
+{
+    kLow,
+    kHigh
+};
+
+enum Unfixed
+{
+    kUnfixed
+};
+
+}  // namespace
+
+template<> struct ara::core::SerializationMembers<Sample>
+{
+    static constexpr std::tuple members{
+      &Sample::timestamp, &Sample::values, &Sample::flags};
+};
+
+template<> struct ara::core::IsBitwiseSerializable<Position> : std::true_type
+{};
+
+TEST_CASE("SerializedSize accounts for lengths and padding", "[SWS_CORE]")
+{
+    CHECK(core::SerializedSize(std::uint16_t{1}) == 2);
+    CHECK(core::SerializedSize(core::Array<std::uint32_t, 3>{}) == 12);
+    CHECK(core::SerializedSize(Position{}) == 8);
+    // length, padding to 8, elements
+    CHECK(core::SerializedSize(core::Vector<double>{1.0, 2.0}) == 4 + 4 + 16);
+    CHECK(core::SerializedSize(core::Vector<std::uint8_t>{1, 2, 3}) == 4 + 3);
+    CHECK(core::SerializedSize(std::pair<std::uint8_t, core::Vector<double>>{
+            1, {1.0}})
+          == 1 + 4 + 3 + 8);
+    CHECK(core::SerializedSize(
+            core::MakeErrorCode(core::CoreErrc::kInvalidArgument, 0))
+          == core::kErrorCodeWireSize);
+}
+
+TEST_CASE("Enumerations are bitwise serializable with a fixed underlying type",
+          "[SWS_CORE]")
+{
+    STATIC_REQUIRE(core::internal::kBitwiseSerializable<Level>);
+    STATIC_REQUIRE_FALSE(core::internal::kBitwiseSerializable<Unfixed>);
+
+    core::Byte const buffer[]{core::Byte{7}};
+    Level            level;
+
+    REQUIRE_FALSE(
+      core::Deserialize(core::Span<core::Byte const>{buffer}, level));
+    CHECK(static_cast<std::uint8_t>(level) == 7);
+}
+
+TEST_CASE("Serialize writes native values and element runs", "[SWS_CORE]")
+{
+    core::Vector<std::uint16_t> const value{0x0102, 0x0304};
+    alignas(8) core::Byte             buffer[16];
+
+    std::size_t const written = core::Serialize(value, buffer);
+
+    REQUIRE(written == core::SerializedSize(value));
+    std::uint32_t length;
+    std::uint16_t elements[2];
+    std::memcpy(&length, static_cast<void const*>(buffer), 4);
+    std::memcpy(elements, static_cast<void const*>(buffer + 4), 4);
+    CHECK(length == 2);
+    CHECK(elements[0] == 0x0102);
+    CHECK(elements[1] == 0x0304);
+}
+
+TEST_CASE("Deserialize restores a type with a member list", "[SWS_CORE]")
+{
+    Sample const sample{42, {1.5f, -2.0f, 3.25f}, {{1, -1}, {7, 3}}};
+    core::Vector<core::Byte> buffer(core::SerializedSize(sample));
+
+    REQUIRE(core::Serialize(sample, buffer) == buffer.size());
+
+    Sample     result;
+    auto const error = core::Deserialize(buffer, result);
+
+    REQUIRE_FALSE(error);
+    CHECK(result.timestamp == 42);
+    CHECK(result.values == sample.values);
+    CHECK(result.flags == sample.flags);
+}
+
+TEST_CASE("Deserialize restores nested and tuple-like values", "[SWS_CORE]")
+{
+    using Value = std::tuple<core::Array<Position, 2>,
+                             core::Vector<core::Vector<std::int16_t>>,
+                             core::Array<core::Vector<std::uint8_t>, 2>,
+                             core::Vector<core::ErrorCode>>;
+    Value const value{
+      {Position{1, 2}, Position{-3, 4}},
+      {{1, 2, 3}, core::Vector<std::int16_t>{}, {-4}},
+      {core::Vector<std::uint8_t>{9}, core::Vector<std::uint8_t>{}},
+      {core::MakeErrorCode(core::CoreErrc::kInvalidMetaModelPath, 5)}};
+    core::Vector<core::Byte> buffer(core::SerializedSize(value));
+    core::Serialize(value, buffer);
+
+    Value      result;
+    auto const error = core::Deserialize(buffer, result);
+
+    REQUIRE_FALSE(error);
+    CHECK(std::get<0>(result) == std::get<0>(value));
+    CHECK(std::get<1>(result) == std::get<1>(value));
+    CHECK(std::get<2>(result) == std::get<2>(value));
+    REQUIRE(std::get<3>(result).size() == 1);
+    CHECK(std::get<3>(result)[0] == std::get<3>(value)[0]);
+    CHECK(std::get<3>(result)[0].SupportData() == 5);
+}
+
+TEST_CASE("Serializer drops the bytes which do not fit", "[SWS_CORE]")
+{
+    core::Vector<std::uint32_t> const values{1, 2, 3};
+    core::Vector<core::Byte>          buffer(16, core::Byte{0xAA});
+
+    auto const size =
+      core::Serialize(values, core::Span<core::Byte>{buffer}.first(10));
+
+    CHECK(size == core::SerializedSize(values));
+    CHECK(buffer[0] == core::Byte{3});
+    CHECK(buffer[3] == core::Byte{0});
+    for (std::size_t i = 4; i < buffer.size(); ++i)
+    {
+        CHECK(buffer[i] == core::Byte{0xAA});
+    }
+
+    core::Serializer empty{core::Span<core::Byte>{}};
+    empty.Write(values);
+    CHECK(empty.Offset() == size);
+    CHECK(empty.Written().empty());
+}
+
+TEST_CASE("Serializer reports an element count exceeding the length type",
+          "[SWS_CORE]")
+{
+    // only the size of the view is read before the count is rejected
+    core::Byte const                   byte{1};
+    core::Span<core::Byte const> const huge{
+      &byte, std::size_t{std::numeric_limits<core::SerializedLengthType>::max()}
+               + 1};
+    core::Byte buffer[16];
+    auto const invalid = std::numeric_limits<std::size_t>::max();
+
+    CHECK(core::SerializedSize(std::pair{std::uint32_t{1}, huge}) == invalid);
+
+    core::Serializer serializer{buffer};
+    serializer.Write(huge).Write(std::uint64_t{1});
+    CHECK(serializer.Offset() == invalid);
+}
+
+TEST_CASE("Deserializer reads element runs as views", "[SWS_CORE]")
+{
+    core::Vector<double> const values{1.0, 2.0, 3.0};
+    core::StringView const     name{"sensor"};
+    alignas(8) core::Byte      buffer[64];
+    core::Serializer           serializer{buffer};
+    serializer.Write(name).Write(values);
+
+    core::Deserializer       deserializer{buffer};
+    core::StringView         nameView;
+    core::Span<double const> valuesView;
+
+    REQUIRE_FALSE(deserializer.Read(nameView));
+    REQUIRE_FALSE(deserializer.Read(valuesView));
+    CHECK(deserializer.Offset() == serializer.Offset());
+    CHECK(nameView == "sensor");
+    CHECK(static_cast<void const*>(nameView.data())
+          == static_cast<void const*>(buffer + 4));
+    REQUIRE(valuesView.size() == 3);
+    CHECK(static_cast<void const*>(valuesView.data())
+          == static_cast<void const*>(buffer + 16));
+    CHECK(valuesView[2] == 3.0);
+}
+
+TEST_CASE("Deserializer rejects malformed input", "[SWS_CORE]")
+{
+    core::Vector<std::uint32_t> const value{1, 2, 3};
+    alignas(8) core::Byte             buffer[16];
+    core::Serialize(value, buffer);
+
+    SECTION("truncated")
+    {
+        core::Vector<std::uint32_t> result;
+        auto const                  error =
+          core::Deserialize(core::Span<core::Byte const>{buffer, 15}, result);
+
+        REQUIRE(error);
+        CHECK(*error == core::CoreErrc::kInvalidArgument);
+    }
+
+    SECTION("length beyond the buffer")
+    {
+        std::uint32_t const length = 0xFFFFFFFF;
+        std::memcpy(static_cast<void*>(buffer), &length, 4);
+        core::Vector<core::Vector<std::uint8_t>> result;
+
+        CHECK(core::Deserialize(core::Span<core::Byte const>{buffer}, result));
+    }
+
+    SECTION("misaligned view")
+    {
+        alignas(8) core::Byte       shifted[24];
+        core::Span<core::Byte> const misaligned{shifted + 4, 20};
+        core::Serialize(core::Vector<double>{1.0}, misaligned);
+        core::Span<double const> view;
+        core::Deserializer       deserializer{misaligned};
+
+        auto const error = deserializer.Read(view);
+
+        REQUIRE(error);
+        CHECK(deserializer.Offset() == 0);
+    }
+
+    SECTION("invalid bool")
+    {
+        alignas(8) core::Byte const bools[]{
+          core::Byte{2}, core::Byte{0}, core::Byte{0}, core::Byte{0},
+          core::Byte{1}, core::Byte{2}};
+        core::Span<core::Byte const> const run{bools};
+        bool                               flag;
+        core::Array<bool, 2>               flags;
+        core::Span<bool const>             view;
+
+        CHECK(core::Deserialize(run, flag));
+        CHECK(core::Deserialize(run.subspan(4), flags));
+        CHECK(core::Deserialize(run, view));
+        REQUIRE_FALSE(core::Deserialize(run.subspan(1), flag));
+        CHECK_FALSE(flag);
+    }
+
+    SECTION("unknown error domain")
+    {
+        core::Byte wire[core::kErrorCodeWireSize]{};
+        auto       code =
+          core::MakeErrorCode(core::CoreErrc::kInvalidArgument, 0);
+
+        CHECK(core::Deserialize(core::Span<core::Byte const>{wire}, code));
+    }
+}
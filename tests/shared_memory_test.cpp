@@ -0,0 +1,279 @@
+#include <catch2/catch.hpp>
+
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <csignal>  // SIGKILL
+#include <cstdint>
+#include <cstring>  // std::memcpy, std::memset
+#include <new>      // std::bad_alloc
+#include <string>
+#include <utility>  // std::pair
+
+#include "ara/core/map.h"
+#include "ara/core/offset_ptr.h"
+#include "ara/core/shared_memory.h"
+#include "ara/core/vector.h"
+
+namespace core = ara::core;
+
+namespace {
+
+using SharedVector = core::Vector<int, core::SharedMemoryAllocator<int>>;
+using MapAllocator =
+  core::FixedSharedMemoryAllocator<std::pair<int const, int>>;
+using SharedMap = core::Map<int, int, std::less<int>, MapAllocator>;
+
+constexpr std::size_t kSegmentSize = 1 << 20;
+
+struct Node
+{
+    int                  values[4];
+    core::OffsetPtr<int> current;
+};
+
+struct Roots
+{
+    core::OffsetPtr<SharedVector> vector;
+    core::OffsetPtr<SharedMap>    map;
+};
+
+}  // namespace
+
+TEST_CASE("OffsetPtr behaves like a pointer", "[SWS_CORE]")
+{
+    int values[4] = {10, 11, 12, 13};
+
+    core::OffsetPtr<int> null;
+    CHECK_FALSE(null);
+    CHECK(null == nullptr);
+    CHECK(null.get() == nullptr);
+
+    core::OffsetPtr<int> p = values;
+    CHECK(p);
+    CHECK(*p == 10);
+    CHECK(p[2] == 12);
+    CHECK(*(p + 3) == 13);
+    CHECK((p + 3) - p == 3);
+    CHECK(p < p + 1);
+
+    core::OffsetPtr<int> const copy = ++p;
+    CHECK(copy.get() == &values[1]);
+    CHECK(*p++ == 11);
+    CHECK(p.get() == &values[2]);
+
+    core::OffsetPtr<void> const erased = p;
+    core::OffsetPtr<int> const  restored{erased};
+    CHECK(restored == p);
+
+    core::OffsetPtr<int const> const constant = p;
+    CHECK(*constant == 12);
+    CHECK(std::pointer_traits<core::OffsetPtr<int>>::pointer_to(values[3]).get()
+          == &values[3]);
+}
+
+TEST_CASE("OffsetPtr stays valid when moved with its pointee", "[SWS_CORE]")
+{
+    alignas(Node) unsigned char first[sizeof(Node)];
+    alignas(Node) unsigned char second[sizeof(Node)];
+
+    auto* const node = new (first) Node{{1, 2, 3, 4}, nullptr};
+    node->current    = &node->values[2];
+
+    // the bytes of a region mapped at another address
+    std::memcpy(second, first, sizeof(Node));
+    auto* const moved = std::launder(reinterpret_cast<Node*>(second));
+
+    CHECK(moved->current.get() == &moved->values[2]);
+    CHECK(*moved->current == 3);
+}
+
+TEST_CASE("SharedMemorySegment allocates and releases memory", "[SWS_CORE]")
+{
+    auto segment = core::SharedMemorySegment::CreateAnonymous(kSegmentSize);
+    REQUIRE(segment);
+    CHECK(segment->Size() == kSegmentSize);
+
+    std::size_t const free = segment->FreeSize();
+    CHECK(free > kSegmentSize - 256);
+
+    void* blocks[100];
+    for (std::size_t i = 0; i < 100; ++i)
+    {
+        blocks[i] = segment->Allocate(i * 37 + 1);
+        REQUIRE(blocks[i] != nullptr);
+        CHECK(reinterpret_cast<std::uintptr_t>(blocks[i])
+                % alignof(std::max_align_t)
+              == 0);
+        std::memset(blocks[i], 0xA5, i * 37 + 1);
+    }
+    CHECK(segment->FreeSize() < free - 100 * 37 * 99 / 2);
+    CHECK(segment->Allocate(kSegmentSize) == nullptr);
+
+    // release in an order which needs merging with both neighbours
+    for (std::size_t i = 0; i < 100; i += 2) { segment->Deallocate(blocks[i]); }
+    for (std::size_t i = 1; i < 100; i += 2) { segment->Deallocate(blocks[i]); }
+    CHECK(segment->FreeSize() == free);
+
+    void* const whole = segment->Allocate(free - 64);
+    CHECK(whole != nullptr);
+    segment->Deallocate(whole);
+}
+
+TEST_CASE("Vector in a segment is shared by mappings at other addresses",
+          "[SWS_CORE]")
+{
+    auto segment = core::SharedMemorySegment::CreateAnonymous(kSegmentSize);
+    REQUIRE(segment);
+    std::size_t const free = segment->FreeSize();
+
+    auto* const vector = segment->Construct<SharedVector>(
+      core::SharedMemoryAllocator<int>{*segment});
+    REQUIRE(vector != nullptr);
+    for (int i = 0; i < 1000; ++i) { vector->push_back(i); }
+    segment->SetRoot(vector);
+
+    auto other =
+      core::SharedMemorySegment::FromFileDescriptor(segment->FileDescriptor());
+    REQUIRE(other);
+    REQUIRE(other->Address() != segment->Address());
+
+    auto* const view = other->Root<SharedVector>();
+    REQUIRE(view != nullptr);
+    CHECK(static_cast<void*>(view) != static_cast<void*>(vector));
+    REQUIRE(view->size() == 1000);
+    CHECK(view->front() == 0);
+    CHECK((*view)[999] == 999);
+
+    // allocation through the other mapping
+    view->resize(5000, 7);
+    CHECK(vector->size() == 5000);
+    CHECK(vector->back() == 7);
+    CHECK((*vector)[999] == 999);
+
+    segment->Destroy(vector);
+    CHECK(other->FreeSize() == free);
+}
+
+TEST_CASE("SharedMemoryAllocator throws std::bad_alloc when exhausted",
+          "[SWS_CORE]")
+{
+    auto segment = core::SharedMemorySegment::CreateAnonymous(4096);
+    REQUIRE(segment);
+
+    SharedVector vector{core::SharedMemoryAllocator<int>{*segment}};
+    CHECK_THROWS_AS(vector.reserve(4096), std::bad_alloc);
+    vector.reserve(512);
+    CHECK(vector.capacity() == 512);
+}
+
+TEST_CASE("Named SharedMemorySegment can be opened by name", "[SWS_CORE]")
+{
+    std::string const name = "/ara-core-test-" + std::to_string(::getpid());
+
+    auto created = core::SharedMemorySegment::Create(name, kSegmentSize);
+    REQUIRE(created);
+    auto const again = core::SharedMemorySegment::Create(name, kSegmentSize);
+    int const  createError = errno;
+    CHECK_FALSE(again);
+    CHECK(createError == EEXIST);
+
+    auto* const value = created->Construct<int>(42);
+    created->SetRoot(value);
+
+    auto opened = core::SharedMemorySegment::Open(name);
+    REQUIRE(opened);
+    CHECK(opened->Size() == kSegmentSize);
+    REQUIRE(opened->Root<int>() != nullptr);
+    CHECK(*opened->Root<int>() == 42);
+
+    CHECK(core::SharedMemorySegment::Remove(name));
+    auto const removed   = core::SharedMemorySegment::Open(name);
+    int const  openError = errno;
+    CHECK_FALSE(removed);
+    CHECK(openError == ENOENT);
+    CHECK_FALSE(core::SharedMemorySegment::Remove(name));
+}
+
+TEST_CASE("SharedMemorySegment recovers from a process killed while "
+          "allocating",
+          "[SWS_CORE]")
+{
+    auto segment = core::SharedMemorySegment::CreateAnonymous(kSegmentSize);
+    REQUIRE(segment);
+
+    for (int round = 0; round < 20; ++round)
+    {
+        pid_t const child = ::fork();
+        REQUIRE(child >= 0);
+        if (child == 0)
+        {
+            // mostly inside the lock of the segment when killed
+            void* blocks[16] = {};
+            for (std::size_t i = 0;; i = (i + 1) % 16)
+            {
+                segment->Deallocate(blocks[i]);
+                blocks[i] = segment->Allocate(i * 37 + 1);
+            }
+        }
+        ::usleep(1000);
+        REQUIRE(::kill(child, SIGKILL) == 0);
+        int status = 0;
+        REQUIRE(::waitpid(child, &status, 0) == child);
+        REQUIRE(WIFSIGNALED(status));
+
+        // blocks of the child are lost, but the free space stays usable
+        std::size_t const free  = segment->FreeSize();
+        void* const       block = segment->Allocate(64);
+        REQUIRE(block != nullptr);
+        CHECK(segment->FreeSize() < free);
+        segment->Deallocate(block);
+        CHECK(segment->FreeSize() == free);
+    }
+}
+
+TEST_CASE("Containers in a segment are built by another process",
+          "[SWS_CORE]")
+{
+    auto segment = core::SharedMemorySegment::CreateAnonymous(kSegmentSize);
+    REQUIRE(segment);
+
+    pid_t const child = ::fork();
+    REQUIRE(child >= 0);
+    if (child == 0)
+    {
+        // Vector via a mapping at another address, Map via the inherited one
+        auto other = core::SharedMemorySegment::FromFileDescriptor(
+          segment->FileDescriptor());
+        if (! other)
+        {
+            ::_exit(1);
+        }
+        auto* const vector = other->Construct<SharedVector>(
+          core::SharedMemoryAllocator<int>{*other});
+        for (int i = 0; i < 100; ++i) { vector->push_back(i * i); }
+
+        auto* const map =
+          segment->Construct<SharedMap>(MapAllocator{*segment});
+        for (int i = 0; i < 100; ++i) { map->emplace(i, -i); }
+
+        // the roots refer to both via the inherited mapping
+        other->SetRoot(vector);
+        segment->SetRoot(segment->Construct<Roots>(
+          Roots{segment->Root<SharedVector>(), map}));
+        ::_exit(0);
+    }
+
+    int status = 0;
+    REQUIRE(::waitpid(child, &status, 0) == child);
+    REQUIRE(WIFEXITED(status));
+    REQUIRE(WEXITSTATUS(status) == 0);
+
+    auto const* const roots = segment->Root<Roots>();
+    REQUIRE(roots != nullptr);
+    REQUIRE(roots->vector->size() == 100);
+    CHECK((*roots->vector)[9] == 81);
+    REQUIRE(roots->map->size() == 100);
+    CHECK(roots->map->at(42) == -42);
+}
@@ -0,0 +1,209 @@
+#include <catch2/catch.hpp>
+
+#include <cstdint>
+#include <tuple>
+#include <vector>
+
+#include "ara/core/array.h"
+#include "ara/core/core_error_domain.h"
+#include "ara/core/map.h"
+#include "ara/core/someip.h"
+#include "ara/core/vector.h"
+#include "byte_helpers.h"
+
+namespace core = ara::core;
+using tests::Bytes;
+
+namespace {
+
+template<typename Encoder, typename T>
+std::vector<core::Byte> Encode(T const& value)
+{
+    core::Byte buffer[64];
+    Encoder    encoder{buffer};
+    REQUIRE_FALSE(encoder.Encode(value));
+    auto const written = encoder.Written();
+    return {written.begin(), written.end()};
+}
+
+enum class Mode : std::uint16_t
+{
+    kOff = 0,
+    kOn  = 0x0102
+};
+
+struct Status
+{
+    std::uint16_t               id;
+    core::Vector<std::uint8_t>  data;
+    std::int32_t                temperature;
+    core::Vector<std::uint16_t> samples;
+};
+
+}  // namespace
+
+template<> struct ara::core::SerializationMembers<Status>
+{
+    static constexpr std::tuple members{
+      &Status::id, &Status::data, &Status::temperature, &Status::samples};
+};
+
+TEST_CASE("SomeIpEncoder writes scalars in big endian", "[SWS_CORE]")
+{
+    using Encoder = core::SomeIpEncoder<>;
+
+    CHECK(Encode<Encoder>(std::uint32_t{0x01020304})
+          == Bytes({0x01, 0x02, 0x03, 0x04}));
+    CHECK(Encode<Encoder>(std::int16_t{-2}) == Bytes({0xFF, 0xFE}));
+    CHECK(Encode<Encoder>(true) == Bytes({0x01}));
+    CHECK(Encode<Encoder>(1.0f) == Bytes({0x3F, 0x80, 0x00, 0x00}));
+    CHECK(Encode<Encoder>(-2.0) == Bytes({0xC0, 0, 0, 0, 0, 0, 0, 0}));
+    CHECK(Encode<Encoder>(Mode::kOn) == Bytes({0x01, 0x02}));
+    CHECK(Encode<Encoder>(core::Byte{0xAB}) == Bytes({0xAB}));
+}
+
+TEST_CASE("SomeIpEncoder writes arrays, vectors and maps", "[SWS_CORE]")
+{
+    using Encoder = core::SomeIpEncoder<>;
+
+    // fixed length array without length field
+    CHECK(Encode<Encoder>(core::Array<std::uint16_t, 2>{
+            std::uint16_t{0x0102}, std::uint16_t{0x0304}})
+          == Bytes({0x01, 0x02, 0x03, 0x04}));
+    // dynamic length array with its length in bytes
+    CHECK(Encode<Encoder>(core::Vector<std::uint16_t>{0x0A0B, 0x0C0D})
+          == Bytes({0, 0, 0, 4, 0x0A, 0x0B, 0x0C, 0x0D}));
+    CHECK(Encode<Encoder>(core::Vector<std::uint8_t>{}) == Bytes({0, 0, 0, 0}));
+    // map as array of key/value structs
+    CHECK(Encode<Encoder>(
+            core::Map<std::uint8_t, std::uint16_t>{{1, 0x0203}, {4, 0x0506}})
+          == Bytes({0, 0, 0, 6, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06}));
+    // nested dynamic length arrays
+    CHECK(Encode<Encoder>(core::Vector<core::Vector<std::uint8_t>>{
+            core::Vector<std::uint8_t>{7}, core::Vector<std::uint8_t>{}})
+          == Bytes({0, 0, 0, 9, 0, 0, 0, 1, 7, 0, 0, 0, 0}));
+}
+
+TEST_CASE("SomeIpEncoder applies the deployment parameters", "[SWS_CORE]")
+{
+    Status const status{0x1234, {1, 2, 3}, -2, {0x0506}};
+
+    CHECK(Encode<core::SomeIpEncoder<>>(status)
+          == Bytes({0x12, 0x34,                 // id
+                    0, 0, 0, 3, 1, 2, 3,        // data
+                    0xFF, 0xFF, 0xFF, 0xFE,     // temperature
+                    0, 0, 0, 2, 0x05, 0x06}));  // samples
+    CHECK(Encode<core::SomeIpEncoder<core::SomeIpConfig{2, 4}>>(status)
+          == Bytes({0x12, 0x34,                 // id
+                    0, 3, 1, 2, 3, 0,           // data, padding
+                    0xFF, 0xFF, 0xFF, 0xFE,     // temperature
+                    0, 2, 0x05, 0x06}));        // samples
+    CHECK(Encode<core::SomeIpEncoder<core::SomeIpConfig{1, 1}>>(
+            core::Vector<std::uint8_t>{9})
+          == Bytes({1, 9}));
+}
+
+TEST_CASE("SomeIpEncoder reports a buffer which is too small", "[SWS_CORE]")
+{
+    core::Byte                       buffer[8];
+    core::SomeIpEncoder<>            encoder{buffer};
+    std::uint16_t const              header = 1;
+    core::Vector<std::uint8_t> const data{1, 2, 3};
+
+    REQUIRE_FALSE(encoder.Encode(header));
+    auto const error = encoder.Encode(data);
+
+    REQUIRE(error);
+    CHECK(*error == core::CoreErrc::kInvalidArgument);
+    CHECK(encoder.Offset() == 2);
+}
+
+TEST_CASE("SomeIpEncoder reports a length exceeding the length field",
+          "[SWS_CORE]")
+{
+    core::Byte                                    buffer[300];
+    core::SomeIpEncoder<core::SomeIpConfig{1, 1}> encoder{buffer};
+
+    REQUIRE_FALSE(encoder.Encode(core::Vector<std::uint8_t>(255)));
+    CHECK(encoder.Encode(core::Vector<std::uint8_t>(256)));
+    CHECK(encoder.Offset() == 256);
+}
+
+TEST_CASE("SomeIpDecoder restores encoded values", "[SWS_CORE]")
+{
+    constexpr core::SomeIpConfig Config{2, 4};
+    Status const status{0x1234, {1, 2, 3}, -2, {0x0506, 0x0708}};
+    core::Map<std::uint16_t, core::Vector<float>> const map{
+      {1, core::Vector<float>{0.5f}}, {2, core::Vector<float>{}}};
+    core::Array<std::int64_t, 2> const array{std::int64_t{-1},
+                                             std::int64_t{1}};
+    core::Byte                         buffer[128];
+    core::SomeIpEncoder<Config>        encoder{buffer};
+    REQUIRE_FALSE(encoder.Encode(status));
+    REQUIRE_FALSE(encoder.Encode(map));
+    REQUIRE_FALSE(encoder.Encode(array));
+
+    core::SomeIpDecoder<Config>                   decoder{encoder.Written()};
+    Status                                        statusResult;
+    core::Map<std::uint16_t, core::Vector<float>> mapResult;
+    core::Array<std::int64_t, 2>                  arrayResult;
+
+    REQUIRE_FALSE(decoder.Decode(statusResult));
+    REQUIRE_FALSE(decoder.Decode(mapResult));
+    REQUIRE_FALSE(decoder.Decode(arrayResult));
+    CHECK(decoder.Remaining().empty());
+    CHECK(statusResult.id == status.id);
+    CHECK(statusResult.data == status.data);
+    CHECK(statusResult.temperature == status.temperature);
+    CHECK(statusResult.samples == status.samples);
+    CHECK(mapResult == map);
+    CHECK(arrayResult == array);
+}
+
+TEST_CASE("SomeIpDecoder rejects malformed payloads", "[SWS_CORE]")
+{
+    core::Vector<std::uint16_t> result;
+
+    SECTION("length beyond the payload")
+    {
+        auto const payload = Bytes({0, 0, 0, 4, 0x01, 0x02});
+        auto const error   = core::SomeIpDecoder<>{payload}.Decode(result);
+
+        REQUIRE(error);
+        CHECK(*error == core::CoreErrc::kInvalidArgument);
+    }
+
+    SECTION("length not a multiple of the element size")
+    {
+        auto const payload = Bytes({0, 0, 0, 3, 0x01, 0x02, 0x03});
+
+        CHECK(core::SomeIpDecoder<>{payload}.Decode(result));
+    }
+
+    SECTION("elements exceeding the length")
+    {
+        core::Vector<core::Vector<std::uint8_t>> nested;
+        auto const payload = Bytes({0, 0, 0, 4, 0, 0, 0, 1, 7});
+
+        CHECK(core::SomeIpDecoder<>{payload}.Decode(nested));
+    }
+
+    SECTION("elements consuming no bytes")
+    {
+        core::Vector<std::tuple<>>           empty;
+        core::Map<std::tuple<>, std::tuple<>> emptyMap;
+        auto const payload = Bytes({0, 0, 0, 4, 0, 0, 0, 0});
+
+        CHECK(core::SomeIpDecoder<>{payload}.Decode(empty));
+        CHECK(core::SomeIpDecoder<>{payload}.Decode(emptyMap));
+    }
+}
+
+TEST_CASE("SomeIpDecoder maps malformed bool bytes to true", "[SWS_CORE]")
+{
+    core::Array<bool, 4> result;
+    auto const           payload = Bytes({0, 1, 2, 0xff});
+
+    REQUIRE_FALSE(core::SomeIpDecoder<>{payload}.Decode(result));
+    CHECK(result == core::Array<bool, 4>{false, true, true, true});
+}
@@ -0,0 +1,291 @@
+#include <catch2/catch.hpp>
+
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+#include "ara/core/spsc_ring.h"
+#include "ara/core/vector.h"
+
+namespace core = ara::core;
+
+namespace {
+
+core::Byte FrameByte(std::size_t frame, std::size_t i)
+{
+    return core::Byte{static_cast<std::uint8_t>(frame * 31 + i)};
+}
+
+/**
+ * Frames of 0 to 100 bytes, whose contents depend on their number.
+ */
+std::vector<core::Byte> Frame(std::size_t frame)
+{
+    std::vector<core::Byte> bytes(frame * 7 % 101);
+    for (std::size_t i = 0; i < bytes.size(); ++i)
+    {
+        bytes[i] = FrameByte(frame, i);
+    }
+    return bytes;
+}
+
+}  // namespace
+
+TEST_CASE("SpscRing is a bounded FIFO", "[SWS_CORE]")
+{
+    core::SpscRing<int, 4> ring;
+    static_assert(core::SpscRing<int, 4>::Capacity() == 4);
+
+    CHECK(ring.Empty());
+    CHECK_FALSE(ring.TryPop());
+
+    for (int round = 0; round < 3; ++round)
+    {
+        for (int i = 0; i < 4; ++i) { CHECK(ring.TryPush(round * 10 + i)); }
+        CHECK_FALSE(ring.TryPush(99));
+        CHECK(ring.Size() == 4);
+
+        for (int i = 0; i < 3; ++i) { CHECK(ring.TryPop() == round * 10 + i); }
+        CHECK(ring.TryPush(round * 10 + 4));
+        CHECK(ring.TryPop() == round * 10 + 3);
+        CHECK(ring.TryPop() == round * 10 + 4);
+        CHECK(ring.Empty());
+    }
+}
+
+TEST_CASE("SpscRing moves elements in and out", "[SWS_CORE]")
+{
+    core::SpscRing<core::Vector<int>, 2> ring;
+
+    core::Vector<int> value{1, 2, 3};
+    CHECK(ring.TryPush(std::move(value)));
+    CHECK(ring.TryPush(core::Vector<int>{4}));
+
+    core::Vector<int> full{5};
+    CHECK_FALSE(ring.TryPush(std::move(full)));
+    CHECK(full.size() == 1);
+
+    CHECK(ring.TryPop() == core::Vector<int>{1, 2, 3});
+    CHECK(ring.TryPop() == core::Vector<int>{4});
+}
+
+TEST_CASE("SpscRing pushes and pops batches across the end", "[SWS_CORE]")
+{
+    core::SpscRing<int, 8> ring;
+    std::vector<int> const values{0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+    std::vector<int>       out(10);
+
+    CHECK(ring.PushBatch(core::Span<int const>{values.data(), 5}) == 5);
+    CHECK(ring.PopBatch(core::Span<int>{out.data(), 3}) == 3);
+    CHECK(out[2] == 2);
+
+    // 2 stored, 6 free, of which 3 before the end
+    CHECK(ring.PushBatch(core::Span<int const>{values}) == 6);
+    CHECK(ring.Size() == 8);
+    CHECK(ring.PopBatch(core::Span<int>{out}) == 8);
+    out.resize(8);
+    CHECK(out == std::vector<int>{3, 4, 0, 1, 2, 3, 4, 5});
+    CHECK(ring.PopBatch(core::Span<int>{out}) == 0);
+}
+
+TEST_CASE("SpscRing regions are contiguous", "[SWS_CORE]")
+{
+    core::SpscRing<int, 8> ring;
+
+    auto region = ring.WriteRegion();
+    REQUIRE(region.size() == 8);
+    for (std::size_t i = 0; i < 6; ++i) { region[i] = static_cast<int>(i); }
+    ring.CommitWrite(6);
+
+    auto read = ring.ReadRegion();
+    REQUIRE(read.size() == 6);
+    CHECK(read[5] == 5);
+    ring.CommitRead(5);
+
+    // from index 6 to the end of the buffer
+    region = ring.WriteRegion();
+    REQUIRE(region.size() == 2);
+    region[0] = 6;
+    region[1] = 7;
+    ring.CommitWrite(2);
+    region = ring.WriteRegion();
+    CHECK(region.size() == 5);
+
+    read = ring.ReadRegion();
+    REQUIRE(read.size() == 3);
+    CHECK(read[0] == 5);
+    CHECK(read[2] == 7);
+}
+
+TEST_CASE("SpscRing transfers elements between threads in order",
+          "[SWS_CORE]")
+{
+    constexpr std::uint64_t             kCount = 1'000'000;
+    core::SpscRing<std::uint64_t, 1024> ring;
+
+    std::thread producer([&ring] {
+        std::uint64_t next = 0;
+        while (next < kCount)
+        {
+            std::uint64_t const before = next;
+            if (next % 2 == 0)
+            {
+                if (ring.TryPush(next)) { ++next; }
+            }
+            else
+            {
+                std::uint64_t batch[16];
+                for (std::uint64_t i = 0; i < 16; ++i) { batch[i] = next + i; }
+                auto const count = std::min<std::uint64_t>(16, kCount - next);
+                next += ring.PushBatch(
+                  core::Span<std::uint64_t const>{batch, count});
+            }
+            if (next == before) { std::this_thread::yield(); }
+        }
+    });
+
+    std::uint64_t expected = 0;
+    bool          inOrder  = true;
+    while (expected < kCount)
+    {
+        std::uint64_t batch[7];
+        std::size_t const count =
+          ring.PopBatch(core::Span<std::uint64_t>{batch});
+        if (count == 0) { std::this_thread::yield(); }
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            inOrder = inOrder && batch[i] == expected++;
+        }
+    }
+    producer.join();
+
+    CHECK(inOrder);
+    CHECK(ring.Empty());
+}
+
+TEST_CASE("SpscFrameRing stores variable length frames", "[SWS_CORE]")
+{
+    core::SpscFrameRing<64> ring;
+    static_assert(core::SpscFrameRing<64>::MaxFrameSize() == 28);
+
+    CHECK_FALSE(ring.TryFrontFrame());
+    CHECK_FALSE(ring.PopFrame());
+    CHECK_FALSE(ring.TryBeginFrame(29));
+
+    auto const first = Frame(3);  // 21 bytes, 28 with the header
+    REQUIRE(ring.TryPushFrame(core::Span<core::Byte const>{first}));
+
+    SECTION("in place")
+    {
+        auto const data = ring.TryBeginFrame(20);
+        REQUIRE(data);
+        CHECK(data->size() == 20);
+        (*data)[0] = core::Byte{42};
+        ring.CommitFrame(1);
+
+        // 28 + 8 bytes used
+        CHECK_FALSE(ring.TryBeginFrame(25));
+        CHECK(ring.TryBeginFrame(24));
+
+        auto const front = ring.TryFrontFrame();
+        REQUIRE(front);
+        CHECK(std::vector<core::Byte>(front->begin(), front->end()) == first);
+        CHECK(ring.PopFrame());
+
+        auto const second = ring.TryFrontFrame();
+        REQUIRE(second);
+        REQUIRE(second->size() == 1);
+        CHECK((*second)[0] == core::Byte{42});
+        CHECK(ring.PopFrame());
+        CHECK(ring.Empty());
+    }
+
+    SECTION("frames are not split at the end of the buffer")
+    {
+        std::vector<core::Byte> const padding(12);
+        REQUIRE(ring.TryPushFrame(core::Span<core::Byte const>{padding}));
+        CHECK(ring.PopFrame());
+        CHECK(ring.PopFrame());
+
+        // 20 bytes left before the end
+        auto const wrapped = Frame(4);  // 28 bytes
+        REQUIRE(ring.TryPushFrame(core::Span<core::Byte const>{wrapped}));
+        auto const front = ring.TryFrontFrame();
+        REQUIRE(front);
+        CHECK(std::vector<core::Byte>(front->begin(), front->end()) == wrapped);
+        CHECK(reinterpret_cast<std::uintptr_t>(front->data()) % 4 == 0);
+        CHECK(ring.PopFrame());
+        CHECK(ring.Empty());
+    }
+}
+
+TEST_CASE("SpscFrameRing accepts the largest frame at any write index",
+          "[SWS_CORE]")
+{
+    core::SpscFrameRing<64>       ring;
+    std::vector<core::Byte> const largest(ring.MaxFrameSize(), core::Byte{7});
+
+    // 32 bytes with the header, leaving the write index in the middle
+    std::vector<core::Byte> const unaligned(28);
+    REQUIRE(ring.TryPushFrame(core::Span<core::Byte const>{unaligned}));
+    CHECK(ring.PopFrame());
+    REQUIRE(ring.TryPushFrame(core::Span<core::Byte const>{largest}));
+    CHECK(ring.PopFrame());
+
+    for (std::size_t i = 0; i < 16; ++i)
+    {
+        // an empty frame moves the write index by 4 bytes
+        REQUIRE(ring.TryPushFrame(core::Span<core::Byte const>{}));
+        CHECK(ring.PopFrame());
+
+        REQUIRE(ring.TryPushFrame(core::Span<core::Byte const>{largest}));
+        auto const front = ring.TryFrontFrame();
+        REQUIRE(front);
+        CHECK(std::vector<core::Byte>(front->begin(), front->end()) == largest);
+        CHECK(ring.PopFrame());
+        CHECK(ring.Empty());
+    }
+}
+
+TEST_CASE("SpscFrameRing transfers frames between threads", "[SWS_CORE]")
+{
+    constexpr std::size_t     kCount = 100'000;
+    core::SpscFrameRing<1024> ring;
+
+    std::thread producer([&ring] {
+        for (std::size_t frame = 0; frame < kCount;)
+        {
+            auto const bytes = Frame(frame);
+            if (ring.TryPushFrame(core::Span<core::Byte const>{bytes}))
+            {
+                ++frame;
+            }
+            else
+            {
+                std::this_thread::yield();
+            }
+        }
+    });
+
+    bool intact = true;
+    for (std::size_t frame = 0; frame < kCount;)
+    {
+        auto const data = ring.TryFrontFrame();
+        if (! data)
+        {
+            std::this_thread::yield();
+            continue;
+        }
+        intact = intact && data->size() == frame * 7 % 101;
+        for (std::size_t i = 0; intact && i < data->size(); ++i)
+        {
+            intact = (*data)[i] == FrameByte(frame, i);
+        }
+        ring.PopFrame();
+        ++frame;
+    }
+    producer.join();
+
+    CHECK(intact);
+    CHECK(ring.Empty());
+}
@@ -0,0 +1,155 @@
+#include <catch2/catch.hpp>
+
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "ara/core/internal/hash.h"
+#include "ara/core/string_interner.h"
+
+namespace core = ara::core;
+
+TEST_CASE("StringInterner returns the same handle for equal strings",
+          "[SWS_CORE]")
+{
+    core::StringInterner interner;
+    std::string          first  = "ServiceName";
+    std::string          second = first;
+
+    auto const lhs = interner.Intern(first);
+    auto const rhs = interner.Intern(second);
+    first.clear();
+
+    CHECK(lhs == rhs);
+    CHECK(lhs.View().data() == rhs.View().data());
+    CHECK(lhs.View() == "ServiceName");
+    CHECK(lhs.View().data()[lhs.View().size()] == '\0');
+    CHECK(lhs.Hash() == core::internal::Fnv1a("ServiceName"));
+    CHECK(interner.Size() == 1);
+    CHECK(interner.Intern("EventName") != lhs);
+    CHECK(interner.Size() == 2);
+}
+
+TEST_CASE("StringInterner::Find does not add strings", "[SWS_CORE]")
+{
+    core::StringInterner interner;
+
+    CHECK_FALSE(interner.Find("ServiceName"));
+    CHECK(interner.Size() == 0);
+
+    auto const handle = interner.Intern("ServiceName");
+    CHECK(interner.Find("ServiceName") == handle);
+}
+
+TEST_CASE("InternedString default constructs to an empty handle",
+          "[SWS_CORE]")
+{
+    core::InternedString handle;
+
+    CHECK_FALSE(handle);
+    CHECK(handle.View().empty());
+    CHECK(handle.Hash() == 0);
+}
+
+TEST_CASE("StringInterner keeps handles stable while growing", "[SWS_CORE]")
+{
+    core::StringInterner              interner;
+    std::vector<core::InternedString> handles;
+
+    for (int i = 0; i < 10000; ++i)
+    {
+        handles.push_back(interner.Intern("Event_" + std::to_string(i)));
+    }
+    handles.push_back(interner.Intern(std::string(100000, 'x')));
+
+    CHECK(interner.Size() == handles.size());
+    for (int i = 0; i < 10000; ++i)
+    {
+        auto const name = "Event_" + std::to_string(i);
+        REQUIRE(handles[static_cast<std::size_t>(i)].View() == name);
+        REQUIRE(interner.Intern(name) == handles[static_cast<std::size_t>(i)]);
+    }
+    CHECK(handles.back().View() == std::string(100000, 'x'));
+}
+
+TEST_CASE("StringInterner counts hits and misses per thread", "[SWS_CORE]")
+{
+    core::StringInterner interner;
+    core::StringInterner::ResetThreadStatistics();
+
+    interner.Intern("ServiceName");
+    interner.Intern("ServiceName");
+    interner.Intern("ServiceName");
+    interner.Find("ServiceName");
+    interner.Find("EventName");
+
+    auto const statistics = core::StringInterner::ThreadStatistics();
+    CHECK(statistics.hits == 3);
+    CHECK(statistics.misses == 1);
+
+    std::thread{[] {
+        auto const other = core::StringInterner::ThreadStatistics();
+        CHECK(other.hits == 0);
+        CHECK(other.misses == 0);
+    }}.join();
+}
+
+TEST_CASE("StringInterner can be used from several threads", "[SWS_CORE]")
+{
+    core::StringInterner     interner;
+    std::vector<std::thread> threads;
+    std::vector<std::vector<core::InternedString>> handles(4);
+
+    for (std::size_t t = 0; t < handles.size(); ++t)
+    {
+        threads.emplace_back([&interner, &result = handles[t]] {
+            for (int i = 0; i < 2000; ++i)
+            {
+                result.push_back(interner.Intern("Name" + std::to_string(i)));
+            }
+        });
+    }
+    for (auto& thread : threads) { thread.join(); }
+
+    CHECK(interner.Size() == 2000);
+    for (auto const& result : handles) { CHECK(result == handles.front()); }
+}
+
+TEST_CASE("StringInterner counts one miss per inserted string under contention",
+          "[SWS_CORE]")
+{
+    core::StringInterner       interner;
+    std::vector<std::thread>   threads;
+    std::vector<std::uint64_t> hits(4);
+    std::vector<std::uint64_t> misses(4);
+
+    for (std::size_t t = 0; t < hits.size(); ++t)
+    {
+        threads.emplace_back([&interner, &hit = hits[t], &miss = misses[t]] {
+            core::StringInterner::ResetThreadStatistics();
+            for (int i = 0; i < 2000; ++i)
+            {
+                interner.Intern("Name" + std::to_string(i));
+            }
+            auto const statistics = core::StringInterner::ThreadStatistics();
+            hit                   = statistics.hits;
+            miss                  = statistics.misses;
+        });
+    }
+    for (auto& thread : threads) { thread.join(); }
+
+    std::uint64_t totalHits   = 0;
+    std::uint64_t totalMisses = 0;
+    for (std::size_t t = 0; t < hits.size(); ++t)
+    {
+        totalHits += hits[t];
+        totalMisses += misses[t];
+    }
+    CHECK(totalMisses == interner.Size());
+    CHECK(totalHits + totalMisses == 4 * 2000);
+}
+
+TEST_CASE("StringInterner::Global returns the same interner", "[SWS_CORE]")
+{
+    CHECK(&core::StringInterner::Global() == &core::StringInterner::Global());
+}
@@ -0,0 +1,300 @@
+#include <catch2/catch.hpp>
+
+#include <cctype>  // std::isxdigit
+#include <cstdint>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "ara/core/core_error_domain.h"
+#include "ara/core/text_encoding.h"
+#include "byte_helpers.h"
+
+namespace core = ara::core;
+using tests::TextBytes;
+
+namespace {
+
+std::vector<core::Byte> RandomBytes(std::size_t size)
+{
+    std::mt19937 engine(static_cast<unsigned int>(size));
+    std::uniform_int_distribution<unsigned int> byte(0, 255);
+    std::vector<core::Byte>                     bytes;
+    for (std::size_t i = 0; i < size; ++i)
+    {
+        bytes.emplace_back(static_cast<std::uint8_t>(byte(engine)));
+    }
+    return bytes;
+}
+
+std::string Hex(std::vector<core::Byte> const& bytes,
+                core::HexCase letterCase = core::HexCase::kLower)
+{
+    std::string text(core::HexEncodedSize(bytes.size()), '\0');
+    REQUIRE_FALSE(
+      core::EncodeHex(core::Span<core::Byte const>{bytes}, text, letterCase));
+    return text;
+}
+
+std::string Base64(std::vector<core::Byte> const& bytes)
+{
+    std::string text(core::Base64EncodedSize(bytes.size()), '\0');
+    REQUIRE_FALSE(
+      core::EncodeBase64(core::Span<core::Byte const>{bytes}, text));
+    return text;
+}
+
+/**
+ * Bit by bit encoding, as a reference for the vectorized kernels.
+ */
+std::string ReferenceBase64(std::vector<core::Byte> const& bytes)
+{
+    char const alphabet[] =
+      "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+    std::string   text;
+    std::uint32_t bits  = 0;
+    std::size_t   count = 0;
+    for (core::Byte const byte : bytes)
+    {
+        bits = bits << 8 | core::to_integer<std::uint8_t>(byte);
+        for (count += 8; count >= 6; count -= 6)
+        {
+            text += alphabet[(bits >> (count - 6)) & 0x3F];
+        }
+    }
+    if (count > 0)
+    {
+        text += alphabet[(bits << (6 - count)) & 0x3F];
+    }
+    text.resize(core::Base64EncodedSize(bytes.size()), '=');
+    return text;
+}
+
+}  // namespace
+
+TEST_CASE("EncodeHex writes two digits per byte", "[SWS_CORE]")
+{
+    auto const bytes = TextBytes(std::string{"\x00\x01\xAB\xFF\x7E", 5});
+
+    CHECK(Hex(bytes) == "0001abff7e");
+    CHECK(Hex(bytes, core::HexCase::kUpper) == "0001ABFF7E");
+    CHECK(Hex({}).empty());
+}
+
+TEST_CASE("EncodeBase64 writes the test vectors of RFC 4648", "[SWS_CORE]")
+{
+    CHECK(Base64(TextBytes("")).empty());
+    CHECK(Base64(TextBytes("f")) == "Zg==");
+    CHECK(Base64(TextBytes("fo")) == "Zm8=");
+    CHECK(Base64(TextBytes("foo")) == "Zm9v");
+    CHECK(Base64(TextBytes("foob")) == "Zm9vYg==");
+    CHECK(Base64(TextBytes("fooba")) == "Zm9vYmE=");
+    CHECK(Base64(TextBytes("foobar")) == "Zm9vYmFy");
+}
+
+TEST_CASE("Decoding restores the encoded bytes", "[SWS_CORE]")
+{
+    for (std::size_t size = 0; size < 200; ++size)
+    {
+        auto const bytes = RandomBytes(size);
+
+        auto const hex = Hex(bytes, size % 2 == 0 ? core::HexCase::kLower
+                                                  : core::HexCase::kUpper);
+        std::vector<core::Byte> fromHex(size);
+        REQUIRE_FALSE(core::DecodeHex(hex, fromHex));
+        CHECK(fromHex == bytes);
+
+        auto const base64 = Base64(bytes);
+        CHECK(base64 == ReferenceBase64(bytes));
+        REQUIRE(core::Base64DecodedSize(base64) == size);
+        std::vector<core::Byte> fromBase64(size);
+        REQUIRE_FALSE(core::DecodeBase64(base64, fromBase64));
+        CHECK(fromBase64 == bytes);
+    }
+}
+
+TEST_CASE("DecodeHex reports the offset of an invalid character",
+          "[SWS_CORE]")
+{
+    std::string const       valid = Hex(RandomBytes(100));
+    std::vector<core::Byte> out(100);
+
+    auto const odd = core::DecodeHex(core::StringView{valid}.substr(1), out);
+    REQUIRE(odd);
+    CHECK(*odd == core::CoreErrc::kInvalidArgument);
+    CHECK(odd->SupportData() == valid.size() - 1);
+
+    for (unsigned int c = 0; c < 256; ++c)
+    {
+        for (std::size_t const position : {0u, 31u, 63u, 150u, 199u})
+        {
+            std::string text = valid;
+            text[position]   = static_cast<char>(c);
+            auto const error = core::DecodeHex(text, out);
+
+            if (std::isxdigit(static_cast<int>(c)) != 0)
+            {
+                CHECK_FALSE(error);
+            }
+            else
+            {
+                REQUIRE(error);
+                CHECK(error->SupportData() == position);
+            }
+        }
+    }
+}
+
+TEST_CASE("DecodeBase64 reports the offset of an invalid character",
+          "[SWS_CORE]")
+{
+    std::string const valid = Base64(RandomBytes(150));
+    std::string const alphabet =
+      "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+    std::vector<core::Byte> out(150);
+
+    auto const truncated =
+      core::DecodeBase64(core::StringView{valid}.substr(1), out);
+    REQUIRE(truncated);
+    CHECK(*truncated == core::CoreErrc::kInvalidArgument);
+    CHECK(truncated->SupportData() == valid.size() - 1);
+
+    for (unsigned int c = 0; c < 256; ++c)
+    {
+        for (std::size_t const position : {0u, 13u, 47u, 120u, 199u})
+        {
+            std::string text = valid;
+            text[position]   = static_cast<char>(c);
+            auto const error = core::DecodeBase64(text, out);
+
+            bool const padding =
+              c == '=' && position + 1 == valid.size();  // "xyz=" is valid
+            if (alphabet.find(static_cast<char>(c)) != std::string::npos
+                || padding)
+            {
+                CHECK_FALSE(error);
+            }
+            else
+            {
+                REQUIRE(error);
+                CHECK(error->SupportData() == position);
+            }
+        }
+    }
+
+    SECTION("padding")
+    {
+        std::vector<core::Byte> small(2);
+        CHECK_FALSE(core::DecodeBase64("Zm8=", small));
+        CHECK(small == TextBytes("fo"));
+        CHECK_FALSE(core::DecodeBase64("Zg==", small));
+        CHECK(small[0] == core::Byte{'f'});
+
+        std::vector<core::Byte> large(5);
+        auto const misplaced = core::DecodeBase64("Zg==Zm8=", large);
+        REQUIRE(misplaced);
+        CHECK(misplaced->SupportData() == 2);
+        auto const excess = core::DecodeBase64("Z===", small);
+        REQUIRE(excess);
+        CHECK(excess->SupportData() == 1);
+    }
+}
+
+TEST_CASE("Encoding and decoding report a buffer which is too small",
+          "[SWS_CORE]")
+{
+    auto const              bytes = RandomBytes(64);
+    std::string             text(core::Base64EncodedSize(bytes.size()), '*');
+    std::vector<core::Byte> out(bytes.size(), core::Byte{0xAA});
+    core::Span<core::Byte const> const in{bytes};
+
+    auto const hex = core::EncodeHex(in, core::Span<char>{text}.first(127));
+    REQUIRE(hex);
+    CHECK(*hex == core::CoreErrc::kInvalidArgument);
+    CHECK(hex->SupportData() == 128);
+    auto const base64 =
+      core::EncodeBase64(in, core::Span<char>{text}.first(text.size() - 1));
+    REQUIRE(base64);
+    CHECK(base64->SupportData() == text.size());
+    CHECK(text == std::string(text.size(), '*'));
+
+    auto const decodeHex = core::DecodeHex(
+      Hex(bytes), core::Span<core::Byte>{out}.first(bytes.size() - 1));
+    REQUIRE(decodeHex);
+    CHECK(decodeHex->SupportData() == bytes.size());
+    auto const decodeBase64 = core::DecodeBase64(
+      Base64(bytes), core::Span<core::Byte>{out}.first(bytes.size() - 1));
+    REQUIRE(decodeBase64);
+    CHECK(decodeBase64->SupportData() == bytes.size());
+    CHECK(out == std::vector<core::Byte>(bytes.size(), core::Byte{0xAA}));
+}
+
+TEST_CASE("Vectorized kernels match the portable ones", "[SWS_CORE]")
+{
+    auto const kernels = core::internal::SupportedTextEncodingKernels();
+    REQUIRE_FALSE(kernels.empty());
+    auto const& scalar = kernels[0];
+    CHECK(std::string{scalar.name} == "scalar");
+    char const digits[] = "0123456789abcdef";
+
+    for (auto const& kernel : kernels)
+    {
+        INFO(kernel.name);
+        for (std::size_t size = 0; size < 200; size += 3)
+        {
+            auto const bytes = RandomBytes(size);
+            auto const in = reinterpret_cast<std::uint8_t const*>(bytes.data());
+
+            std::string hex(2 * size, '\0');
+            std::string expectedHex(2 * size, '\0');
+            kernel.encodeHex(in, size, hex.data(), digits);
+            scalar.encodeHex(in, size, expectedHex.data(), digits);
+            CHECK(hex == expectedHex);
+
+            std::string base64(size / 3 * 4, '\0');
+            std::string expectedBase64(size / 3 * 4, '\0');
+            kernel.encodeBase64(in, size, base64.data());
+            scalar.encodeBase64(in, size, expectedBase64.data());
+            CHECK(base64 == expectedBase64);
+
+            // an invalid character in turn at each position, and none
+            for (std::size_t position = 0; position <= hex.size();
+                 position += 7)
+            {
+                std::string text = hex;
+                if (position < text.size())
+                {
+                    text[position] = 'g';
+                }
+                std::vector<std::uint8_t> out(size);
+                std::vector<std::uint8_t> expected(size);
+                CHECK(kernel.decodeHex(text.data(), text.size(), out.data())
+                      == scalar.decodeHex(
+                        text.data(), text.size(), expected.data()));
+                if (position >= text.size())
+                {
+                    CHECK(out == expected);
+                }
+            }
+            for (std::size_t position = 0; position <= base64.size();
+                 position += 5)
+            {
+                std::string text = base64;
+                if (position < text.size())
+                {
+                    text[position] = '=';
+                }
+                std::vector<std::uint8_t> out(size);
+                std::vector<std::uint8_t> expected(size);
+                CHECK(
+                  kernel.decodeBase64(text.data(), text.size(), out.data())
+                  == scalar.decodeBase64(
+                    text.data(), text.size(), expected.data()));
+                if (position >= text.size())
+                {
+                    CHECK(out == expected);
+                }
+            }
+        }
+    }
+}
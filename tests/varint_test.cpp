@@ -0,0 +1,188 @@
+#include <catch2/catch.hpp>
+
+#include <algorithm>  // std::equal
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <vector>
+
+#include "ara/core/varint.h"
+#include "byte_helpers.h"
+
+namespace core = ara::core;
+using tests::Bytes;
+
+namespace {
+
+template<typename T> std::vector<core::Byte> Encode(T value)
+{
+    std::vector<core::Byte> out(core::kMaxVarintSize<T>);
+    out.resize(core::EncodeVarint(value, core::Span<core::Byte>{out}));
+    return out;
+}
+
+/**
+ * Values of 1 to kMaxVarintSize<T> bytes, mostly small ones.
+ */
+template<typename T> std::vector<T> RandomValues(std::size_t count)
+{
+    std::mt19937_64                 engine{7};
+    std::uniform_int_distribution<> bits(0, sizeof(T) * 8);
+    std::vector<T>                  values;
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        auto const width = static_cast<unsigned>(bits(engine));
+        auto const value = static_cast<T>(engine());
+        values.push_back(i % 3 == 0 || width == sizeof(T) * 8
+                           ? value
+                           : static_cast<T>(value & ((T{1} << width) - 1)));
+    }
+    return values;
+}
+
+}  // namespace
+
+TEST_CASE("ZigZagEncode interleaves negative and positive numbers",
+          "[SWS_CORE]")
+{
+    static_assert(core::ZigZagEncode(std::int32_t{0}) == 0u);
+    static_assert(core::ZigZagEncode(std::int32_t{-1}) == 1u);
+    static_assert(core::ZigZagEncode(std::int32_t{1}) == 2u);
+    static_assert(core::ZigZagEncode(std::int32_t{-2}) == 3u);
+    static_assert(core::ZigZagEncode(std::numeric_limits<std::int32_t>::max())
+                  == 0xFFFFFFFEu);
+    static_assert(core::ZigZagEncode(std::numeric_limits<std::int32_t>::min())
+                  == 0xFFFFFFFFu);
+    static_assert(core::ZigZagEncode(std::int64_t{-3}) == 5u);
+
+    for (std::int64_t const value :
+         {std::int64_t{0},
+          std::int64_t{-1},
+          std::int64_t{123456789},
+          std::numeric_limits<std::int64_t>::min(),
+          std::numeric_limits<std::int64_t>::max()})
+    {
+        CHECK(core::ZigZagDecode(core::ZigZagEncode(value)) == value);
+    }
+}
+
+TEST_CASE("EncodeVarint writes LEB128", "[SWS_CORE]")
+{
+    CHECK(Encode(std::uint32_t{0}) == Bytes({0x00}));
+    CHECK(Encode(std::uint32_t{1}) == Bytes({0x01}));
+    CHECK(Encode(std::uint32_t{127}) == Bytes({0x7F}));
+    CHECK(Encode(std::uint32_t{128}) == Bytes({0x80, 0x01}));
+    CHECK(Encode(std::uint32_t{300}) == Bytes({0xAC, 0x02}));
+    CHECK(Encode(std::uint32_t{0xFFFFFFFF})
+          == Bytes({0xFF, 0xFF, 0xFF, 0xFF, 0x0F}));
+    CHECK(Encode(std::numeric_limits<std::uint64_t>::max())
+          == Bytes(
+            {0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x01}));
+    CHECK(core::VarintSize(std::uint64_t{1} << 56) == 9);
+}
+
+TEST_CASE("DecodeVarint rejects malformed input", "[SWS_CORE]")
+{
+    std::uint32_t value32 = 0;
+    std::uint64_t value64 = 0;
+
+    auto const valid = Bytes({0xAC, 0x02, 0x99});
+    CHECK(core::DecodeVarint(core::Span<core::Byte const>{valid}, value32)
+          == 2);
+    CHECK(value32 == 300);
+
+    auto const truncated = Bytes({0x80, 0x80});
+    CHECK(core::DecodeVarint(core::Span<core::Byte const>{truncated}, value32)
+          == 0);
+
+    auto const overflow32 = Bytes({0xFF, 0xFF, 0xFF, 0xFF, 0x1F});
+    CHECK(core::DecodeVarint(core::Span<core::Byte const>{overflow32}, value32)
+          == 0);
+    CHECK(core::DecodeVarint(core::Span<core::Byte const>{overflow32}, value64)
+          == 5);
+
+    auto const tooLong = Bytes({0x80, 0x80, 0x80, 0x80, 0x80, 0x00});
+    CHECK(core::DecodeVarint(core::Span<core::Byte const>{tooLong}, value32)
+          == 0);
+}
+
+TEMPLATE_TEST_CASE("DecodeVarints restores EncodeVarints",
+                   "[SWS_CORE]",
+                   std::uint32_t,
+                   std::uint64_t)
+{
+    auto const values = RandomValues<TestType>(1000);
+    std::vector<core::Byte> encoded(values.size()
+                                    * core::kMaxVarintSize<TestType>);
+    std::size_t const       size =
+      core::EncodeVarints(core::Span<TestType const>{values}, encoded);
+    encoded.resize(size);
+
+    std::size_t expectedSize = 0;
+    for (TestType const value : values)
+    {
+        expectedSize += core::VarintSize(value);
+    }
+    CHECK(size == expectedSize);
+
+    std::vector<TestType> decoded(values.size());
+    auto const            result =
+      core::DecodeVarints(core::Span<core::Byte const>{encoded},
+                          core::Span<TestType>{decoded});
+
+    CHECK(result.values == values.size());
+    CHECK(result.bytes == size);
+    CHECK(decoded == values);
+
+    SECTION("runs of single byte varints")
+    {
+        std::vector<TestType> const small(100, TestType{5});
+        std::vector<core::Byte>     smallEncoded(small.size());
+        core::EncodeVarints(core::Span<TestType const>{small}, smallEncoded);
+        std::vector<TestType> smallDecoded(small.size());
+
+        auto const smallResult =
+          core::DecodeVarints(core::Span<core::Byte const>{smallEncoded},
+                              core::Span<TestType>{smallDecoded});
+
+        CHECK(smallResult.values == small.size());
+        CHECK(smallDecoded == small);
+    }
+
+    SECTION("output smaller than the input")
+    {
+        std::vector<TestType> partial(10);
+        auto const            partialResult =
+          core::DecodeVarints(core::Span<core::Byte const>{encoded},
+                              core::Span<TestType>{partial});
+
+        CHECK(partialResult.values == 10);
+        CHECK(std::equal(partial.begin(), partial.end(), values.begin()));
+    }
+}
+
+TEST_CASE("DecodeVarints stops at the first malformed varint", "[SWS_CORE]")
+{
+    auto bytes = Bytes({0x01, 0x02, 0x80, 0x01, 0x03, 0x04, 0x05, 0x06,
+                        0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E});
+    // a 6 byte varint, too long for 32 bit values
+    auto const tooLong = Bytes({0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x01});
+    bytes.insert(bytes.end(), tooLong.begin(), tooLong.end());
+    bytes.resize(bytes.size() + 16, core::Byte{0x01});
+    std::vector<std::uint32_t> values(64);
+
+    auto const result = core::DecodeVarints(
+      core::Span<core::Byte const>{bytes}, core::Span<std::uint32_t>{values});
+
+    CHECK(result.values == 15);
+    CHECK(result.bytes == 16);
+    CHECK(values[2] == 128);
+
+    std::vector<std::uint64_t> values64(64);
+    auto const                 result64 =
+      core::DecodeVarints(core::Span<core::Byte const>{bytes},
+                          core::Span<std::uint64_t>{values64});
+
+    CHECK(result64.values == 32);
+    CHECK(result64.bytes == bytes.size());
+}
@@ -219,6 +219,7 @@ TEST_CASE("Vector - reserve", "[SWS_CORE], [SWS_CORE_01301]")
     std::size_t size = 100;
     vector.reserve(size);
     CHECK(100 == vector.capacity());
+    CHECK(5 == vector.size());
 }
 
 TEST_CASE("Vector - shrink_to_fit, clear", "[SWS_CORE], [SWS_CORE_01301]")